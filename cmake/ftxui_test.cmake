@@ -24,6 +24,7 @@ add_executable(ftxui-tests
   src/ftxui/component/slider_test.cpp
   src/ftxui/component/terminal_input_parser_test.cpp
   src/ftxui/component/toggle_test.cpp
+  src/ftxui/component/window_test.cpp
   src/ftxui/dom/blink_test.cpp
   src/ftxui/dom/bold_test.cpp
   src/ftxui/dom/border_test.cpp
@@ -31,21 +32,31 @@ add_executable(ftxui-tests
   src/ftxui/dom/color_test.cpp
   src/ftxui/dom/dbox_test.cpp
   src/ftxui/dom/dim_test.cpp
+  src/ftxui/dom/display_list_test.cpp
   src/ftxui/dom/flexbox_helper_test.cpp
   src/ftxui/dom/flexbox_test.cpp
   src/ftxui/dom/gauge_test.cpp
   src/ftxui/dom/gridbox_test.cpp
+  src/ftxui/dom/hash_test.cpp
   src/ftxui/dom/hbox_test.cpp
+  src/ftxui/dom/heatmap_test.cpp
   src/ftxui/dom/hyperlink_test.cpp
+  src/ftxui/dom/lazy_test.cpp
   src/ftxui/dom/linear_gradient_test.cpp
+  src/ftxui/dom/parallel_test.cpp
+  src/ftxui/dom/reconciler_test.cpp
   src/ftxui/dom/scroll_indicator_test.cpp
   src/ftxui/dom/separator_test.cpp
   src/ftxui/dom/spinner_test.cpp
+  src/ftxui/dom/static_box_test.cpp
+  src/ftxui/dom/style_test.cpp
   src/ftxui/dom/table_test.cpp
   src/ftxui/dom/text_test.cpp
+  src/ftxui/dom/time_series_test.cpp
   src/ftxui/dom/underlined_test.cpp
   src/ftxui/dom/vbox_test.cpp
   src/ftxui/screen/color_test.cpp
+  src/ftxui/screen/screen_test.cpp
   src/ftxui/screen/string_test.cpp
 )
 
@@ -107,17 +107,25 @@ int main() {
     return canvas(std::move(c));
   });
 
-  // A text following the mouse
+  // A text following the mouse. The canvas is kept across frames, and only
+  // the previous text is erased.
+  auto text_canvas = Canvas(100, 100);
+  int text_x = 0;
+  int text_y = 0;
   auto renderer_text = Renderer([&] {
-    auto c = Canvas(100, 100);
-    c.DrawText(0, 0, "A piece of text");
-    c.DrawText(mouse_x, mouse_y, "This is a piece of text with effects",
-               [](Pixel& p) {
-                 p.foreground_color = Color::Red;
-                 p.underlined = true;
-                 p.bold = true;
-               });
-    return canvas(std::move(c));
+    const std::string text = "This is a piece of text with effects";
+    // The mouse position is in cells, so |text_x| and |text_y| are multiples
+    // of 2 and 4: the rectangle covers the cells of the previous text exactly.
+    text_canvas.ClearRect(text_x, text_y, int(text.size()) * 2, 4);
+    text_canvas.DrawText(0, 0, "A piece of text");
+    text_canvas.DrawText(mouse_x, mouse_y, text, [](Pixel& p) {
+      p.foreground_color = Color::Red;
+      p.underlined = true;
+      p.bold = true;
+    });
+    text_x = mouse_x;
+    text_y = mouse_y;
+    return canvas(&text_canvas);
   });
 
   auto renderer_plot_1 = Renderer([&] {
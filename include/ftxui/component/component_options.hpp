@@ -255,6 +255,12 @@ struct WindowOptions {
   Ref<bool> resize_top = true;    /// < Can the top side be resized?
   Ref<bool> resize_down = true;   /// < Can the down side be resized?
 
+  /// Keep the drawing of the window, and draw it again instead of rendering
+  /// the inner component, until the window receives an event or its position,
+  /// size or state changes. Dragging the window then only costs a copy. The
+  /// cursor and the boxes reflected by the inner component are kept too.
+  Ref<bool> cache = false;
+
   /// An optional function to customize how the window looks like:
   std::function<Element(const WindowRenderState&)> render;
 };
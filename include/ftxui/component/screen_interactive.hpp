@@ -2,6 +2,7 @@
 #define FTXUI_COMPONENT_SCREEN_INTERACTIVE_HPP
 
 #include <atomic>                        // for atomic
+#include <cstddef>                       // for size_t
 #include <ftxui/component/receiver.hpp>  // for Receiver, Sender
 #include <functional>                    // for function
 #include <memory>                        // for shared_ptr
@@ -104,6 +105,10 @@ class ScreenInteractive : public Screen {
 
   bool frame_valid_ = false;
 
+  // The structural hash of the last frame drawn. See Node::Hash().
+  bool frame_hashed_ = false;
+  size_t frame_hash_ = 0;
+
   friend class Loop;
 
  public:
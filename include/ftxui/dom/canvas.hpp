@@ -1,13 +1,15 @@
 #ifndef FTXUI_DOM_CANVAS_HPP
 #define FTXUI_DOM_CANVAS_HPP
 
-#include <cstddef>        // for size_t
-#include <functional>     // for function
-#include <string>         // for string
-#include <unordered_map>  // for unordered_map
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t
+#include <functional>  // for function
+#include <string>      // for string
+#include <vector>      // for vector
 
+#include "ftxui/screen/box.hpp"     // for Box
 #include "ftxui/screen/color.hpp"   // for Color
-#include "ftxui/screen/screen.hpp"  // for Pixel
+#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
 
 #ifdef DrawText
 // Workaround for WinUsr.h (via Windows.h) defining macros that break things.
@@ -29,6 +31,11 @@ struct Canvas {
 
   using Stylizer = std::function<void(Pixel&)>;
 
+  struct Point {
+    int x = 0;
+    int y = 0;
+  };
+
   // Draws using braille characters --------------------------------------------
   void DrawPointOn(int x, int y);
   void DrawPointOff(int x, int y);
@@ -52,6 +59,17 @@ struct Canvas {
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Color& color);
   void DrawPointEllipseFilled(int x, int y, int r1, int r2, const Stylizer& s);
 
+  // Draws many braille dots at once -------------------------------------------
+  void DrawPoints(const std::vector<Point>& points);
+  void DrawPoints(const std::vector<Point>& points, const Color& color);
+  void DrawPointPolyline(const std::vector<Point>& points);
+  void DrawPointPolyline(const std::vector<Point>& points, const Color& color);
+  void DrawPointScatter(const int* xs, const int* ys, size_t count);
+  void DrawPointScatter(const int* xs,
+                        const int* ys,
+                        size_t count,
+                        const Color& color);
+
   // Draw using box characters -------------------------------------------------
   // Block are of size 1x2. y is considered to be a multiple of 2.
   void DrawBlockOn(int x, int y);
@@ -92,42 +110,80 @@ struct Canvas {
   void DrawText(int x, int y, const std::string& value, const Color& color);
   void DrawText(int x, int y, const std::string& value, const Stylizer& style);
 
+  // Draw an image using half block characters --------------------------------
+  // Draw the RGB image |rgb| of |width| x |height| pixels at (x, y), one pixel
+  // per dot. |stride| is the number of bytes between two rows. Every cell
+  // shows two colors, the average of the 2x2 pixels of its top and bottom half.
+  void DrawImage(int x,
+                 int y,
+                 int width,
+                 int height,
+                 const uint8_t* rgb,
+                 int stride);
+
   // Decorator:
   // x is considered to be a multiple of 2.
   // y is considered to be a multiple of 4.
   void Style(int x, int y, const Stylizer& style);
 
+  // Erase ---------------------------------------------------------------------
+  // Erase the dots, the blocks and the image halves inside the rectangle of
+  // |width| x |height| dots at (x, y), and the text of the cells it touches.
+  // The cells entirely inside are reset, style included.
+  void ClearRect(int x, int y, int width, int height);
+
+  // Draw the canvas into the area |box| of |screen|. The cells are converted
+  // into pixels again only when they were modified since the previous call,
+  // so that a persistent canvas only pays for what changed between frames.
+  void Blit(Screen& screen, const Box& box) const;
+
  private:
   bool IsIn(int x, int y) const {
     return x >= 0 && x < width_ && y >= 0 && y < height_;
   }
-  enum CellType {
+  enum CellType : uint8_t {
     kBraille,
     kBlock,
     kText,
+    kHalfBlock,
   };
   struct Cell {
     CellType type = kText;
-    Pixel content;
-  };
-  struct XY {
-    int x;
-    int y;
-    bool operator==(const XY& other) const {
-      return x == other.x && y == other.y;
-    }
+    // The braille dots, the 4 quadrants of the block, or the 2 halves drawn by
+    // DrawImage().
+    uint8_t mask = 0;
+    // The foreground color set by the bulk drawing functions and DrawImage().
+    // It overrides the one of the style.
+    bool has_color = false;
+    Color color;
+    // The color of the bottom half of kHalfBlock cells.
+    Color background;
+    // Whether the cell was modified since Blit() converted it into a pixel.
+    mutable bool dirty = true;
   };
 
-  struct XYHash {
-    size_t operator()(const XY& xy) const {
-      constexpr size_t shift = 1024;
-      return size_t(xy.x) * shift + size_t(xy.y);
-    }
-  };
+  // The index of the cell containing the dot (x, y).
+  size_t Index(int x, int y) const {
+    return size_t(y / 4) * size_t(cells_x_) + size_t(x / 2);
+  }
+  Cell& BrailleCell(int x, int y);
+  Cell& BlockCell(int x, int y);
+  // The style of the cell |index|, and the character of the text cells.
+  Pixel& StyleAt(size_t index);
+
+  // Draw a braille dot or a line, of |color| unless null.
+  void Plot(int x, int y, const Color* color);
+  void PlotLine(int x1, int y1, int x2, int y2, const Color* color);
 
   int width_ = 0;
   int height_ = 0;
-  std::unordered_map<XY, Cell, XYHash> storage_;
+  int cells_x_ = 0;
+  int cells_y_ = 0;
+  std::vector<Cell> cells_;
+  // Parallel to |cells_|. Allocated once a cell is styled.
+  std::vector<Pixel> styles_;
+  // Parallel to |cells_|. The cells converted into pixels by Blit().
+  mutable std::vector<Pixel> pixels_;
 };
 
 }  // namespace ftxui
@@ -0,0 +1,44 @@
+#ifndef FTXUI_DOM_COLOR_MAP_HPP
+#define FTXUI_DOM_COLOR_MAP_HPP
+
+#include <vector>  // for vector
+
+#include "ftxui/screen/color.hpp"  // for Color
+
+namespace ftxui {
+
+/// @brief A mapping from values to colors, used by ftxui::heatmap.
+///
+/// The colors are evenly spaced from |low| to |high|. Values outside of the
+/// range get the color of the nearest end. |low| may be greater than |high|.
+///
+/// Example:
+/// ```cpp
+/// ColorMap(Color::Blue, Color::Red).Range(0.f, 100.f);
+/// ColorMap()
+///    .Stop(Color::Black)
+///    .Stop(Color::Red)
+///    .Stop(Color::Yellow)
+///    .Range(0.f, 100.f);
+/// ```
+struct ColorMap {
+  std::vector<Color> colors;
+  float low = 0.f;
+  float high = 1.f;
+
+  // Simple constructor
+  ColorMap();
+  ColorMap(Color begin, Color end);
+
+  // Modifier using the builder pattern.
+  ColorMap& Range(float low, float high);
+  ColorMap& Stop(Color color);
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_COLOR_MAP_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
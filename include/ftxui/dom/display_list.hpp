@@ -0,0 +1,87 @@
+#ifndef FTXUI_DOM_DISPLAY_LIST_HPP
+#define FTXUI_DOM_DISPLAY_LIST_HPP
+
+#include <cstddef>  // for size_t
+#include <string>   // for string
+#include <vector>   // for vector
+
+#include "ftxui/dom/node.hpp"       // for Element, Node
+#include "ftxui/dom/style.hpp"      // for Style
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
+
+namespace ftxui {
+
+// A flat list of drawing operations, recorded from a laid out Element tree.
+// Executing it produces the same result as rendering the tree, without walking
+// it. It can be kept and replayed as long as the layout doesn't change.
+//
+// Usage:
+//
+// auto list = Compile(screen, document);
+// Render(screen, list);
+// ...
+// screen.Clear();
+// Render(screen, list);  // Replay
+class DisplayList {
+ public:
+  // Recording:
+  void FillRect(Box box, const Pixel& pixel);
+  void FillGlyph(Box box, const std::string& glyph);
+  void DrawGlyphs(int x, int y, int x_max, const std::string& text);
+  void ApplyStyle(Box box, const Style& style);
+  void SetCursor(Screen::Cursor cursor);
+  void PushStencil(Box box);
+  void PopStencil();
+  void Draw(Node* node);
+
+  void Clear();
+  size_t size() const { return ops_.size(); }
+
+  // Replay:
+  void Execute(Screen& screen) const;
+
+ private:
+  struct Op {
+    enum class Type : uint8_t {
+      FillRect,
+      FillGlyph,
+      DrawGlyphs,
+      ApplyStyle,
+      SetCursor,
+      PushStencil,
+      PopStencil,
+      Draw,
+    };
+    Type type;
+    Box box;
+    size_t index = 0;  // Into the storage associated with |type|.
+    size_t size = 0;
+  };
+
+  friend DisplayList Compile(Screen& screen, Element element);
+
+  std::vector<Op> ops_;
+  std::vector<Pixel> pixels_;
+  std::vector<std::string> glyphs_;
+  std::vector<Style> styles_;
+  std::vector<Screen::Cursor> cursors_;
+  std::vector<Node*> nodes_;
+
+  // Keep the recorded nodes alive, so the list can be replayed.
+  Element root_;
+};
+
+// Layout |element| to fit |screen| and record its drawing.
+DisplayList Compile(Screen& screen, Element element);
+
+// Draw a display list on |screen|.
+void Render(Screen& screen, const DisplayList& list);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_DISPLAY_LIST_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
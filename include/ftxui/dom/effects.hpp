@@ -0,0 +1,62 @@
+#ifndef FTXUI_DOM_EFFECTS_HPP
+#define FTXUI_DOM_EFFECTS_HPP
+
+#include <vector>  // for vector
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+// The effects of drawing elements, other than their pixels: the boxes set by
+// reflect() and the cursor. When a drawing is reused instead of being done
+// again, like the keyed elements of a Reconciler, its effects are applied
+// again.
+struct Effects {
+  // A box set by reflect().
+  struct Reflected {
+    Box* target = nullptr;
+    Box box;
+  };
+  std::vector<Reflected> reflected;
+  bool moves_cursor = false;
+  Screen::Cursor cursor;
+  // False when some effects couldn't be recorded, because they happened on
+  // other threads, inside a parallel() element.
+  bool complete = true;
+
+  // Apply the effects to |screen|, moved by (dx, dy). The reflected boxes are
+  // clipped to the stencil.
+  void Replay(Screen& screen, int dx, int dy) const;
+};
+
+// Record into |effects| the effects of the drawing done on |screen| by this
+// thread, from its construction to its destruction. The recorders can be
+// nested.
+class EffectsRecorder {
+ public:
+  EffectsRecorder(const Screen& screen, Effects* effects);
+  ~EffectsRecorder();
+  EffectsRecorder(const EffectsRecorder&) = delete;
+  EffectsRecorder& operator=(const EffectsRecorder&) = delete;
+
+  // Called by reflect() once |box| is set.
+  static void OnReflect(Box& box);
+  // Called by parallel() before drawing from other threads, whose effects
+  // can't be recorded.
+  static void OnUntracked();
+
+ private:
+  const Screen& screen_;
+  Effects* effects_;
+  Screen::Cursor cursor_;
+  EffectsRecorder* parent_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_EFFECTS_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
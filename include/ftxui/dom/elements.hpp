@@ -5,10 +5,13 @@
 #include <memory>
 
 #include "ftxui/dom/canvas.hpp"
+#include "ftxui/dom/color_map.hpp"
 #include "ftxui/dom/direction.hpp"
 #include "ftxui/dom/flexbox_config.hpp"
 #include "ftxui/dom/linear_gradient.hpp"
 #include "ftxui/dom/node.hpp"
+#include "ftxui/dom/style.hpp"
+#include "ftxui/dom/time_series.hpp"
 #include "ftxui/screen/box.hpp"
 #include "ftxui/screen/color.hpp"
 #include "ftxui/screen/screen.hpp"
@@ -39,10 +42,12 @@ Element operator|(Element, Decorator);
 Element& operator|=(Element&, Decorator);
 Elements operator|(Elements, Decorator);
 Decorator operator|(Decorator, Decorator);
+Element operator|(Element, const Style&);
 
 // --- Widget ---
 Element text(std::string text);
 Element vtext(std::string text);
+Element richText(std::vector<Span> spans);
 Element separator();
 Element separatorLight();
 Element separatorDashed();
@@ -89,6 +94,9 @@ Element emptyElement();
 Element canvas(ConstRef<Canvas>);
 Element canvas(int width, int height, std::function<void(Canvas&)>);
 Element canvas(std::function<void(Canvas&)>);
+Element timeSeries(ConstRef<TimeSeries>);
+Element timeSeries(ConstRef<TimeSeries>, float low, float high);
+Element heatmap(const float* data, int rows, int cols, ColorMap);
 
 // -- Decorator ---
 Element bold(Element);
@@ -171,6 +179,12 @@ Decorator reflect(Box& box);
 // Before drawing the |element| clear the pixel below. This is useful in
 // combinaison with dbox.
 Element clear_under(Element element);
+// Build an element using |factory| only when it is visible. |hint| is used as
+// its requirement.
+Element lazy(Requirement hint, std::function<Element()> factory);
+// Lay out and draw the large children of the containers inside |element|
+// concurrently.
+Element parallel(Element element);
 
 // --- Util --------------------------------------------------------------------
 Element hcenter(Element);
@@ -1,8 +1,9 @@
 #ifndef FTXUI_DOM_NODE_HPP
 #define FTXUI_DOM_NODE_HPP
 
-#include <memory>  // for shared_ptr
-#include <vector>  // for vector
+#include <cstddef>  // for size_t
+#include <memory>   // for shared_ptr
+#include <vector>   // for vector
 
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -12,6 +13,7 @@ namespace ftxui {
 
 class Node;
 class Screen;
+class DisplayList;
 
 using Element = std::shared_ptr<Node>;
 using Elements = std::vector<Element>;
@@ -36,10 +38,21 @@ class Node {
   // Step 2: Assign this element its final dimensions.
   //         Propagated from Parents to Children.
   virtual void SetBox(Box box);
+  Box box() const { return box_; }
 
   // Step 3: Draw this element.
   virtual void Render(Screen& screen);
 
+  // The area fully overwritten when drawing this element, hiding whatever was
+  // drawn below. It is used to skip drawing occluded layers. Available after
+  // SetBox().
+  virtual Box OpaqueBox();
+
+  // Step 3 (alternative): Record the drawing of this element into a display
+  //         list, to be replayed later. By default, the whole element is
+  //         recorded as a single call to Render().
+  virtual void Compile(DisplayList& list);
+
   // Layout may not resolve within a single iteration for some elements. This
   // allows them to request additionnal iterations. This signal must be
   // forwarded to children at least once.
@@ -49,7 +62,20 @@ class Node {
   };
   virtual void Check(Status* status);
 
+  // Combine the type, content, style and requirement of this element and of
+  // its children into |hash|. Two elements with the same hash draw the same
+  // thing. Called after ComputeRequirement(). Returns false when the element
+  // can't be hashed, which is the default.
+  virtual bool Hash(size_t* hash);
+
  protected:
+  // Whether |child| is, at least partially, inside the visible area.
+  static bool IsVisible(const Node& child, const Screen& screen);
+
+  // Hash the type and the requirement of this element, then its children.
+  // This implements Hash() for elements without additional content.
+  bool HashChildren(size_t* hash);
+
   Elements children_;
   Requirement requirement_;
   Box box_;
@@ -58,6 +84,9 @@ class Node {
 void Render(Screen& screen, const Element& element);
 void Render(Screen& screen, Node* node);
 
+// Run the layout algorithm (Step 1 and 2), so that |node| fits |box|.
+void Layout(Node* node, Box box);
+
 }  // namespace ftxui
 
 #endif  // FTXUI_DOM_NODE_HPP
@@ -0,0 +1,89 @@
+#ifndef FTXUI_DOM_RECONCILER_HPP
+#define FTXUI_DOM_RECONCILER_HPP
+
+#include <cstddef>        // for size_t
+#include <string>         // for string
+#include <unordered_map>  // for unordered_map
+#include <vector>         // for vector
+
+#include "ftxui/dom/effects.hpp"    // for Effects
+#include "ftxui/dom/elements.hpp"   // for Decorator, Element
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
+
+namespace ftxui {
+
+// Draw successive frames, built from new Element trees, while reusing the
+// drawing of the keyed elements unchanged since the previous frame. Elements
+// are matched by key. Their drawing is copied instead of being done again
+// when their type, content, style, position and the pixels below them are
+// the same.
+//
+// Usage:
+//
+// Reconciler reconciler;
+// ...
+// auto document = vbox({
+//     Header(),
+//     Content() | key("content"),
+// });
+// reconciler.Render(screen, document);
+// for (const Box& box : reconciler.changed()) {
+//   ...
+// }
+class Reconciler {
+ public:
+  // Layout and draw |element| on |screen|.
+  void Render(Screen& screen, const Element& element);
+
+  // The areas of the screen modified by the last call to Render().
+  const std::vector<Box>& changed() const { return changed_; }
+
+  // The number of keyed elements reused by the last call to Render().
+  int reused() const { return reused_; }
+
+ private:
+  class Keyed;
+  friend Decorator key(std::string key);
+
+  // The drawing of a keyed element, from the previous frame.
+  struct Entry {
+    bool valid = false;
+    int generation = 0;
+    size_t hash = 0;
+    Box box;
+    std::vector<Pixel> below;  // The pixels before drawing the element.
+    std::vector<Pixel> drawn;  // The pixels after drawing the element.
+    // Replayed when the drawing is reused, as the element isn't drawn.
+    Effects effects;
+    std::vector<std::string> keys;  // The keyed elements nested inside.
+  };
+
+  // Mark the keyed element |key| as present in this frame, with the ones
+  // nested inside its reused drawing.
+  void Seen(const std::string& key);
+
+  void ComputeChanged(const Screen& screen);
+
+  std::unordered_map<std::string, Entry> entries_;
+  int generation_ = 0;
+  int reused_ = 0;
+  std::vector<Entry*> recording_;  // The keyed elements being drawn.
+
+  std::vector<Box> changed_;
+  int previous_dimx_ = 0;
+  int previous_dimy_ = 0;
+  std::vector<Pixel> previous_;
+};
+
+// Identify an element across the frames drawn by a Reconciler. Without an
+// active Reconciler, this has no effect.
+Decorator key(std::string key);
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_RECONCILER_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,192 @@
+#ifndef FTXUI_DOM_STATIC_BOX_HPP
+#define FTXUI_DOM_STATIC_BOX_HPP
+
+#include <algorithm>  // for max
+#include <array>      // for array
+#include <cstddef>    // for size_t
+#include <memory>     // for make_shared
+#include <string>     // for string
+#include <tuple>      // for tuple, get
+#include <utility>    // for move, index_sequence, make_index_sequence
+#include <vector>     // for vector
+
+#include "ftxui/dom/elements.hpp"   // for Element
+#include "ftxui/dom/node.hpp"       // for Node
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+// Layouts whose structure is known at compile time, like a status bar. The
+// children are stored inline, without shared_ptr, and are laid out and drawn
+// using static dispatch instead of the virtual methods of Node. The flex
+// factors are compile time constants, and so are the sizes of the children
+// whose size doesn't depend on their content.
+//
+// The whole layout is a single Element, usable as a leaf of any other Element
+// tree.
+//
+// Usage:
+//
+// Element status = static_hbox(Static::Text("CPU "),
+//                              Static::Gauge(cpu),
+//                              Static::Separator(),
+//                              Static::Text("MEM "),
+//                              Static::Gauge(memory));
+namespace Static {
+
+// Every child type provides:
+// - flex_grow_x, flex_shrink_x: The flex factors, known at compile time.
+// - min_x(), min_y(): The required size.
+// - Render(screen, box): Draw the child inside |box|.
+
+// A single line of text. See ftxui::text.
+class Text {
+ public:
+  explicit Text(const std::string& text);
+
+  static constexpr int flex_grow_x = 0;
+  static constexpr int flex_shrink_x = 0;
+  int min_x() const { return static_cast<int>(glyphs_.size()); }
+  static constexpr int min_y() { return 1; }
+
+  void Render(Screen& screen, const Box& box) const;
+
+ private:
+  std::vector<std::string> glyphs_;
+};
+
+// A horizontal gauge, taking the remaining space. See ftxui::gauge.
+class Gauge {
+ public:
+  explicit Gauge(float progress);
+
+  static constexpr int flex_grow_x = 1;
+  static constexpr int flex_shrink_x = 1;
+  static constexpr int min_x() { return 1; }
+  static constexpr int min_y() { return 1; }
+
+  void Render(Screen& screen, const Box& box) const;
+
+ private:
+  float progress_;
+};
+
+// A vertical line. See ftxui::separator.
+class Separator {
+ public:
+  static constexpr int flex_grow_x = 0;
+  static constexpr int flex_shrink_x = 0;
+  static constexpr int min_x() { return 1; }
+  static constexpr int min_y() { return 1; }
+
+  static void Render(Screen& screen, const Box& box);
+};
+
+// Distribute |target_size| among |count| children, the same way ftxui::hbox
+// does. |size| contains the minimum sizes on input, and the result on output.
+void Layout(const int* flex_grow,
+            const int* flex_shrink,
+            int* size,
+            size_t count,
+            int target_size);
+
+// Children displayed horizontally one by one. See ftxui::hbox.
+template <typename... Children>
+class HBox {
+ public:
+  explicit HBox(Children... children) : children_(std::move(children)...) {}
+
+  static constexpr int flex_grow_x = 0;
+  static constexpr int flex_shrink_x = 0;
+  constexpr int min_x() const { return MinX(kIndexes); }
+  constexpr int min_y() const { return MinY(kIndexes); }
+
+  void Render(Screen& screen, const Box& box) const {
+    Render(screen, box, kIndexes);
+  }
+
+ private:
+  static constexpr size_t kSize = sizeof...(Children);
+  static constexpr auto kIndexes = std::make_index_sequence<kSize>();
+  static constexpr std::array<int, kSize> kFlexGrow = {
+      Children::flex_grow_x...};
+  static constexpr std::array<int, kSize> kFlexShrink = {
+      Children::flex_shrink_x...};
+
+  template <size_t... I>
+  constexpr int MinX(std::index_sequence<I...> /*unused*/) const {
+    return (0 + ... + std::get<I>(children_).min_x());
+  }
+
+  template <size_t... I>
+  constexpr int MinY(std::index_sequence<I...> /*unused*/) const {
+    return std::max({0, std::get<I>(children_).min_y()...});
+  }
+
+  template <size_t... I>
+  void Render(Screen& screen,
+              const Box& box,
+              std::index_sequence<I...> /*unused*/) const {
+    std::array<int, kSize> size = {std::get<I>(children_).min_x()...};
+    Layout(kFlexGrow.data(), kFlexShrink.data(), size.data(), kSize,
+           box.x_max - box.x_min + 1);
+    int x = box.x_min;
+    (RenderChild(std::get<I>(children_), screen, box, size[I], &x), ...);
+  }
+
+  template <typename Child>
+  static void RenderChild(const Child& child,
+                          Screen& screen,
+                          Box box,
+                          int size,
+                          int* x) {
+    box.x_min = *x;
+    box.x_max = *x + size - 1;
+    *x += size;
+    if (box.x_min <= box.x_max) {
+      child.Render(screen, box);
+    }
+  }
+
+  std::tuple<Children...> children_;
+};
+
+// Adapt a Static container into a Node.
+template <typename Container>
+class Adapter : public Node {
+ public:
+  explicit Adapter(Container container) : container_(std::move(container)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = container_.min_x();
+    requirement_.min_y = container_.min_y();
+    requirement_.flex_grow_x = Container::flex_grow_x;
+    requirement_.flex_shrink_x = Container::flex_shrink_x;
+  }
+
+  void Render(Screen& screen) override { container_.Render(screen, box_); }
+
+ private:
+  Container container_;
+};
+
+}  // namespace Static
+
+/// @brief A container displaying elements horizontally one by one, whose
+/// children are known at compile time. See ftxui::Static.
+/// @ingroup dom
+template <typename... Children>
+Element static_hbox(Children... children) {
+  using Container = Static::HBox<Children...>;
+  return std::make_shared<Static::Adapter<Container>>(
+      Container(std::move(children)...));
+}
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_STATIC_BOX_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,65 @@
+#ifndef FTXUI_DOM_STYLE_HPP
+#define FTXUI_DOM_STYLE_HPP
+
+#include <cstdint>  // for uint16_t
+#include <string>   // for string
+
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Pixel
+
+namespace ftxui {
+
+// A set of attributes applied to the pixels of an element. Unlike chaining
+// decorators, it is a plain value: several attributes can be combined and
+// applied in a single pass.
+//
+// Usage:
+//
+// text("ftxui") | Style::Set(Style::kBold | Style::kUnderlined)
+//               | Style::Foreground(Color::Red);
+struct Style {
+  enum Attribute : uint16_t {
+    kBlink = 1 << 0,
+    kBold = 1 << 1,
+    kDim = 1 << 2,
+    kInverted = 1 << 3,
+    kUnderlined = 1 << 4,
+    kUnderlinedDouble = 1 << 5,
+    kStrikethrough = 1 << 6,
+    kAutomerge = 1 << 7,
+    kForegroundColor = 1 << 8,
+    kBackgroundColor = 1 << 9,
+  };
+  uint16_t set = 0;     // Attributes to set.
+  uint16_t toggle = 0;  // Attributes to toggle.
+  Color foreground_color;
+  Color background_color;
+
+  static Style Set(uint16_t attributes);
+  static Style Toggle(uint16_t attributes);
+  static Style Foreground(Color color);
+  static Style Background(Color color);
+
+  bool empty() const { return set == 0 && toggle == 0; }
+
+  // Combine |next|, applied after this style, into this style. Return false,
+  // leaving this style unchanged, when no single style is equivalent.
+  bool Merge(const Style& next);
+
+  void Apply(Pixel& pixel) const;
+};
+
+// A piece of text drawn using a Style. See ftxui::richText.
+struct Span {
+  std::string text;
+  Style style;
+  std::string link;  // Optional hyperlink.
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_STYLE_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
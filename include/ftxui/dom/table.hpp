@@ -1,9 +1,11 @@
 #ifndef FTXUI_DOM_TABLE
 #define FTXUI_DOM_TABLE
 
+#include <functional>  // for function
 #include <memory>
-#include <string>  // for string
-#include <vector>  // for vector
+#include <string>   // for string
+#include <utility>  // for pair
+#include <vector>   // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, Decorator
 
@@ -27,15 +29,35 @@ namespace ftxui {
 // table.SelectRow(1).SeparatorInternal(Light);
 //
 // std::move(table).Element();
+//
+// Virtualized table:
+// ------------------
+//
+// auto table = Table(1'000'000, 3, [](int row, int column) {
+//   return std::to_string(row * column);
+// });
+// table.SelectAll().Border(LIGHT);
+// table.SelectColumn(0).Decorate(bold);
+//
+// table.Render() | focusPositionRelative(0, 0.5) | frame;
+//
+// Cells are built on demand, only for the rows and columns visible inside the
+// enclosing frame. Column widths are declared with SetColumnWidth(), or
+// estimated from a sample of the rows otherwise.
 
 class Table;
 class TableSelection;
+class VirtualTable;
 
 class Table {
  public:
   Table();
   Table(std::vector<std::vector<std::string>>);
   Table(std::vector<std::vector<Element>>);
+  Table(int rows,
+        int columns,
+        std::function<std::string(int row, int column)> cell);
+  void SetColumnWidth(int column, int width);
   TableSelection SelectAll();
   TableSelection SelectCell(int column, int row);
   TableSelection SelectRow(int row_index);
@@ -50,12 +72,35 @@ class Table {
 
  private:
   void Initialize(std::vector<std::vector<Element>>);
+  Table Window(int x_min, int x_max, int y_min, int y_max) const;
+  bool Contain(int x, int y) const;
+  Element& At(int x, int y);
   friend TableSelection;
+  friend VirtualTable;
   std::vector<std::vector<Element>> elements_;
   int input_dim_x_ = 0;
   int input_dim_y_ = 0;
   int dim_x_ = 0;
   int dim_y_ = 0;
+
+  // Position of |elements_| in the table. Non zero only for the window of a
+  // virtualized table.
+  int origin_x_ = 0;
+  int origin_y_ = 0;
+
+  // Virtualized table:
+  struct Deferred {
+    int x_min;
+    int x_max;
+    int y_min;
+    int y_max;
+    std::function<void(TableSelection&)> apply;
+  };
+  std::function<std::string(int row, int column)> cell_;
+  std::vector<int> column_widths_;
+  std::vector<bool> separator_columns_;
+  std::vector<std::pair<int, int>> separator_rows_;
+  std::vector<Deferred> deferred_;
 };
 
 class TableSelection {
@@ -79,6 +124,14 @@ class TableSelection {
   void SeparatorHorizontal(BorderStyle border = LIGHT);
 
  private:
+  bool Defer(std::function<void(TableSelection&)> apply);
+  void MarkSeparatorColumns(int x_min, int x_max);
+  void MarkSeparatorRows(int y_min, int y_max);
+  int XBegin(int x) const;
+  int XEnd(int x) const;
+  int YBegin(int y) const;
+  int YEnd(int y) const;
+
   friend Table;
   Table* table_;
   int x_min_;
@@ -0,0 +1,72 @@
+#ifndef FTXUI_DOM_TIME_SERIES_HPP
+#define FTXUI_DOM_TIME_SERIES_HPP
+
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
+namespace ftxui {
+
+// A fixed number of samples, the most recent ones. Appending a sample drops the
+// oldest one once full.
+//
+// The minimum and the maximum of the samples are kept by blocks, and updated
+// as samples are appended, so that the minimum and the maximum of a range are
+// computed without visiting most of its samples. See ftxui::timeSeries.
+//
+// Usage:
+//
+// TimeSeries series(1'000'000);
+// series.Push(value);
+// ...
+// Element document = timeSeries(&series);
+class TimeSeries {
+ public:
+  TimeSeries() = default;
+  explicit TimeSeries(size_t capacity);
+
+  // Append a sample. Once full, the oldest one is dropped.
+  void Push(float value);
+  void Clear();
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return values_.size(); }
+
+  // The sample |index|, from the oldest one.
+  float operator[](size_t index) const { return values_[Slot(index)]; }
+
+  // The lowest and the highest of the samples [begin, end), from the oldest
+  // one. The range must not be empty.
+  struct Bounds {
+    float low = 0.F;
+    float high = 0.F;
+  };
+  Bounds Range(size_t begin, size_t end) const;
+
+ private:
+  // The number of samples of a block.
+  static constexpr size_t kBlockSize = 64;
+
+  size_t Slot(size_t index) const {
+    const size_t slot = start_ + index;
+    return slot < values_.size() ? slot : slot - values_.size();
+  }
+  // Extend |bounds| with the slots [begin, end) of |values_|.
+  void Extend(size_t begin, size_t end, Bounds* bounds) const;
+
+  std::vector<float> values_;
+  size_t start_ = 0;  // The slot of the oldest sample.
+  size_t size_ = 0;
+
+  // The bounds of the samples of every block of slots. The block of the last
+  // appended sample may also contain older samples not taken into account, so
+  // it is never used.
+  std::vector<Bounds> blocks_;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_TIME_SERIES_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
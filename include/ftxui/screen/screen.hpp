@@ -1,7 +1,9 @@
 #ifndef FTXUI_SCREEN_SCREEN_HPP
 #define FTXUI_SCREEN_SCREEN_HPP
 
-#include <cstdint>  // for uint8_t
+#include <algorithm>  // for max, min
+#include <cstdint>    // for uint8_t
+#include <iosfwd>     // for stringstream
 #include <memory>
 #include <string>  // for string, basic_string, allocator
 #include <vector>  // for vector
@@ -50,6 +52,17 @@ struct Pixel {
         automerge(false) {}
 };
 
+/// @brief A contiguous run of pixels, within a row of a Screen.
+/// @ingroup screen
+struct PixelSpan {
+  Pixel* data = nullptr;
+  int x = 0;  // The position of the first pixel.
+  int size = 0;
+
+  Pixel* begin() const { return data; }
+  Pixel* end() const { return data + size; }
+};
+
 /// @brief Define how the Screen's dimensions should look like.
 /// @ingroup screen
 namespace Dimension {
@@ -74,7 +87,21 @@ class Screen {
   Pixel& PixelAt(int x, int y);
   const Pixel& PixelAt(int x, int y) const;
 
+  // Access the cells of the row |y| in [x_min, x_max], clipped to the stencil.
+  // The bounds are checked once for the whole row.
+  PixelSpan RowSpan(int y, int x_min, int x_max);
+
+  // Bulk operations on the cells of |box|, clipped to the stencil.
+  void FillRect(const Box& box, const Pixel& pixel);
+  template <typename Function>
+  void ForEachPixel(const Box& box, Function function);
+
+  // Copy |size| cells into the row |y|, starting at |x|, clipped to the
+  // stencil.
+  void BlitRow(int x, int y, const Pixel* pixels, int size);
+
   std::string ToString() const;
+  std::string ToString(int threads) const;
 
   // Print the Screen on to the terminal.
   void Print() const;
@@ -104,7 +131,7 @@ class Screen {
       BarBlinking = 5,
       Bar = 6,
     };
-    Shape shape;
+    Shape shape = Hidden;
   };
   Cursor cursor() const { return cursor_; }
   void SetCursor(Cursor cursor) { cursor_ = cursor; }
@@ -117,6 +144,8 @@ class Screen {
   Box stencil;
 
  protected:
+  void SerializeRows(std::stringstream& ss, int y_begin, int y_end) const;
+
   int dimx_;
   int dimy_;
   std::vector<std::vector<Pixel>> pixels_;
@@ -124,6 +153,18 @@ class Screen {
   std::vector<std::string> hyperlinks_ = {""};
 };
 
+/// @brief Call |function| on every cell of |box|, clipped to the stencil.
+template <typename Function>
+void Screen::ForEachPixel(const Box& box, Function function) {
+  const int y_min = std::max(box.y_min, stencil.y_min);
+  const int y_max = std::min(box.y_max, stencil.y_max);
+  for (int y = y_min; y <= y_max; ++y) {
+    for (Pixel& pixel : RowSpan(y, box.x_min, box.x_max)) {
+      function(pixel);
+    }
+  }
+}
+
 }  // namespace ftxui
 
 #endif  // FTXUI_SCREEN_SCREEN_HPP
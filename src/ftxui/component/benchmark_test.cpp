@@ -0,0 +1,94 @@
+#include <benchmark/benchmark.h>
+#include <string>   // for to_string
+#include <utility>  // for move
+
+#include "ftxui/component/component.hpp"          // for Renderer, Window
+#include "ftxui/component/component_base.hpp"     // for ComponentBase, Component
+#include "ftxui/component/component_options.hpp"  // for WindowOptions
+#include "ftxui/component/event.hpp"              // for Event
+#include "ftxui/component/mouse.hpp"              // for Mouse, Mouse::Left, Mouse::Pressed
+#include "ftxui/dom/elements.hpp"                 // for text, separator, gauge, hbox, vbox, operator|, bold, color, Element
+#include "ftxui/dom/node.hpp"                     // for Render
+#include "ftxui/screen/color.hpp"                 // for Color
+#include "ftxui/screen/screen.hpp"                // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Event MouseEvent(Mouse::Motion motion, int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = motion;
+  mouse.shift = false;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
+
+Component ComplexWindow(int index, bool cache) {
+  auto content = Renderer([] {
+    Elements lines;
+    for (int y = 0; y < 40; ++y) {
+      lines.push_back(hbox({
+          text("Line " + std::to_string(y)) | bold,
+          separator(),
+          gauge(0.5f) | color(Color::Red),
+      }));
+    }
+    return vbox(std::move(lines));
+  });
+  WindowOptions option;
+  option.inner = content;
+  option.title = "Window " + std::to_string(index);
+  // Every window hides the right part of the previous one.
+  option.left = 5 * index;
+  option.top = 0;
+  option.width = 60;
+  option.height = 30;
+  option.cache = cache;
+  return Window(std::move(option));
+}
+
+// Drag one window over ten other complex ones.
+void BenchmarkDragWindow(benchmark::State& state) {
+  const bool cache = state.range(0);
+  Components windows;
+  for (int i = 0; i < 11; ++i) {
+    windows.push_back(ComplexWindow(i, cache));
+  }
+  auto dragged = windows.back();
+  auto container = Container::Stacked(windows);
+  dragged->TakeFocus();
+
+  Screen screen(120, 50);
+  Render(screen, container->Render());
+
+  // Grab the content of the last window.
+  int x = 55;
+  int y = 5;
+  container->OnEvent(MouseEvent(Mouse::Pressed, x, y));
+  int direction = 1;
+  while (state.KeepRunning()) {
+    x += direction;
+    if (x == 65 || x == 25) {
+      direction = -direction;
+    }
+    container->OnEvent(MouseEvent(Mouse::Pressed, x, y));
+    screen.Clear();
+    Render(screen, container->Render());
+  }
+}
+BENCHMARK(BenchmarkDragWindow)->Arg(false)->Arg(true);
+
+}  // namespace
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -24,6 +24,7 @@
 #include "ftxui/component/receiver.hpp"  // for ReceiverImpl, Sender, MakeReceiver, SenderImpl, Receiver
 #include "ftxui/component/screen_interactive.hpp"
 #include "ftxui/component/terminal_input_parser.hpp"  // for TerminalInputParser
+#include "ftxui/dom/hash.hpp"                         // for HashValue
 #include "ftxui/dom/node.hpp"                         // for Node, Render
 #include "ftxui/dom/requirement.hpp"                  // for Requirement
 #include "ftxui/screen/terminal.hpp"                  // for Dimensions, Size
@@ -489,6 +490,7 @@ ScreenInteractive* ScreenInteractive::Active() {
 
 void ScreenInteractive::Install() {
   frame_valid_ = false;
+  frame_hashed_ = false;
 
   // After uninstalling the new configuration, flush it to the terminal to
   // ensure it is fully applied:
@@ -703,6 +705,20 @@ void ScreenInteractive::Draw(Component component) {
       break;
   }
 
+  // Skip the frame when it is identical to the previous one.
+  size_t hash = 0;
+  HashValue(&hash, terminal.dimx);
+  HashValue(&hash, terminal.dimy);
+  HashValue(&hash, dimx);
+  HashValue(&hash, dimy);
+  const bool hashed = document->Hash(&hash);
+  if (hashed && frame_hashed_ && hash == frame_hash_) {
+    frame_valid_ = true;
+    return;
+  }
+  frame_hashed_ = hashed;
+  frame_hash_ = hash;
+
   const bool resized = (dimx != dimx_) || (dimy != dimy_);
   ResetCursorPosition();
   std::cout << ResetPosition(/*clear=*/resized);
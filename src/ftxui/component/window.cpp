@@ -1,9 +1,20 @@
 #define NOMINMAX
-#include <algorithm>
-#include <ftxui/component/component.hpp>
-#include <ftxui/component/component_base.hpp>
-#include <ftxui/component/screen_interactive.hpp>  // for ScreenInteractive
+#include <algorithm>   // for find, max, min
+#include <array>       // for array
+#include <functional>  // for function
+#include <memory>      // for make_shared
+#include <string>      // for string
+#include <utility>     // for move
+#include <vector>      // for vector
+
+#include "ftxui/component/component.hpp"           // for Window
+#include "ftxui/component/component_base.hpp"      // for ComponentBase
+#include "ftxui/component/screen_interactive.hpp"  // for ScreenInteractive
+#include "ftxui/dom/effects.hpp"                   // for Effects, EffectsRecorder
+#include "ftxui/dom/hash.hpp"                      // for HashValue
 #include "ftxui/dom/node_decorator.hpp"            // for NodeDecorator
+#include "ftxui/screen/box.hpp"                    // for Box
+#include "ftxui/screen/screen.hpp"                 // for Pixel, PixelSpan, Screen
 
 namespace ftxui {
 
@@ -75,6 +86,15 @@ class ResizeDecorator : public NodeDecorator {
     }
   }
 
+  bool Hash(size_t* hash) override {
+    HashValue(hash, color_);
+    HashValue(hash, resize_left_);
+    HashValue(hash, resize_right_);
+    HashValue(hash, resize_top_);
+    HashValue(hash, resize_down_);
+    return HashChildren(hash);
+  }
+
   Color color_;
   const bool resize_left_;
   const bool resize_right_;
@@ -82,6 +102,149 @@ class ResizeDecorator : public NodeDecorator {
   const bool resize_down_;
 };
 
+// The drawing of a window, recorded to be drawn again without rendering its
+// component.
+struct Layer {
+  bool valid = false;
+  int version = 0;  // Incremented every time the layer is recorded.
+  int width = 0;
+  int height = 0;
+  std::vector<Pixel> pixels;
+  // The hyperlinks used by the pixels, indexed by their id.
+  std::vector<std::string> links;
+  // The boxes reflected by the inner components and the cursor, relative to
+  // the position the layer was recorded at.
+  Effects effects;
+  int x = 0;
+  int y = 0;
+
+  // The state the layer was recorded with.
+  std::string title;
+  int left = 0;
+  int top = 0;
+  std::array<bool, 7> flags = {};
+};
+
+// Draw |child|, and record the result into |layer|.
+class LayerRecorder : public NodeDecorator {
+ public:
+  LayerRecorder(Element child, Layer* layer)
+      : NodeDecorator(std::move(child)), layer_(layer) {}
+
+  void Render(Screen& screen) override {
+    {
+      const EffectsRecorder recorder(screen, &layer_->effects);
+      NodeDecorator::Render(screen);
+    }
+
+    // Only an opaque drawing of the whole window can be drawn again
+    // elsewhere. A window partially hidden below another one is still drawn
+    // whole by dbox, so only the clipping by the stencil matters.
+    layer_->valid = layer_->effects.complete && OpaqueBox() == box_ &&
+                    Box::Intersection(box_, screen.stencil) == box_;
+    if (!layer_->valid) {
+      return;
+    }
+
+    layer_->version++;
+    layer_->x = box_.x_min;
+    layer_->y = box_.y_min;
+    layer_->width = box_.x_max - box_.x_min + 1;
+    layer_->height = box_.y_max - box_.y_min + 1;
+    layer_->pixels.resize(size_t(layer_->width * layer_->height));
+    layer_->links = {""};
+    auto pixel = layer_->pixels.begin();
+    for (int y = box_.y_min; y <= box_.y_max; ++y) {
+      for (int x = box_.x_min; x <= box_.x_max; ++x) {
+        *pixel = screen.PixelAt(x, y);
+        if (pixel->hyperlink) {
+          const std::string& link = screen.Hyperlink(pixel->hyperlink);
+          auto it = std::find(layer_->links.begin(), layer_->links.end(), link);
+          pixel->hyperlink = uint8_t(it - layer_->links.begin());
+          if (it == layer_->links.end()) {
+            layer_->links.push_back(link);
+          }
+        }
+        ++pixel;
+      }
+    }
+  }
+
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
+
+ private:
+  Layer* layer_;
+};
+
+// Draw the content of |layer|. When the window is given a different size, for
+// instance when it is squeezed against the side of the screen, |fallback| is
+// used to render it again.
+class LayerPlayer : public Node {
+ public:
+  LayerPlayer(const Layer* layer, std::function<Element()> fallback)
+      : layer_(layer), fallback_(std::move(fallback)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = layer_->width;
+    requirement_.min_y = layer_->height;
+  }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    if (box.x_max - box.x_min + 1 == layer_->width &&
+        box.y_max - box.y_min + 1 == layer_->height) {
+      return;
+    }
+    children_ = {fallback_()};
+    children_[0]->ComputeRequirement();
+    children_[0]->SetBox(box);
+  }
+
+  Box OpaqueBox() override {
+    return children_.empty() ? box_ : Node::OpaqueBox();
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, layer_);
+    HashValue(hash, layer_->version);
+    return HashChildren(hash);
+  }
+
+  void Render(Screen& screen) override {
+    if (!children_.empty()) {
+      Node::Render(screen);
+      return;
+    }
+
+    std::vector<uint8_t> links(layer_->links.size(), 0);
+    for (size_t i = 1; i < links.size(); ++i) {
+      links[i] = screen.RegisterHyperlink(layer_->links[i]);
+    }
+
+    const int width = std::min(layer_->width, box_.x_max - box_.x_min + 1);
+    const int height = std::min(layer_->height, box_.y_max - box_.y_min + 1);
+    for (int dy = 0; dy < height; ++dy) {
+      const int y = box_.y_min + dy;
+      screen.BlitRow(box_.x_min, y,
+                     layer_->pixels.data() + size_t(dy * layer_->width), width);
+      const PixelSpan span =
+          screen.RowSpan(y, box_.x_min, box_.x_min + width - 1);
+      for (Pixel& pixel : span) {
+        pixel.hyperlink = links[pixel.hyperlink];
+      }
+    }
+
+    // The inner components aren't drawn. Their boxes, used to dispatch the
+    // mouse events, and their cursor are restored at the new position.
+    layer_->effects.Replay(screen, box_.x_min - layer_->x,
+                           box_.y_min - layer_->y);
+  }
+
+ private:
+  const Layer* layer_;
+  std::function<Element()> fallback_;
+};
+
 Element DefaultRenderState(const WindowRenderState& state) {
   Element element = state.inner;
   if (state.active) {
@@ -116,13 +279,12 @@ class WindowImpl : public ComponentBase, public WindowOptions {
 
  private:
   Element Render() final {
-    auto element = ComponentBase::Render();
-
-    bool captureable =
-        captured_mouse_ || ScreenInteractive::Active()->CaptureMouse();
+    const bool captureable =
+        captured_mouse_ || (ScreenInteractive::Active() &&
+                            ScreenInteractive::Active()->CaptureMouse());
 
     const WindowRenderState state = {
-        element,
+        nullptr,
         title(),
         Active(),
         drag_,
@@ -133,7 +295,35 @@ class WindowImpl : public ComponentBase, public WindowOptions {
         (resize_down_hover_ || resize_down_) && captureable,
     };
 
-    element = render ? render(state) : DefaultRenderState(state);
+    const std::array<bool, 7> flags = {
+        state.active,      state.drag,      state.resize,     state.hover_left,
+        state.hover_right, state.hover_top, state.hover_down,
+    };
+    const bool cacheable = cache() && layer_.valid && !invalid_ &&
+                           layer_.left == left() && layer_.top == top() &&
+                           layer_.width == width() &&
+                           layer_.height == height() && layer_.flags == flags &&
+                           layer_.title == title();
+
+    auto draw = [this, state, flags] {
+      WindowRenderState fresh_state = state;
+      fresh_state.inner = ComponentBase::Render();
+      Element element =
+          render ? render(fresh_state) : DefaultRenderState(fresh_state);
+      if (cache()) {
+        element = std::make_shared<LayerRecorder>(element, &layer_);
+        layer_.valid = false;
+        layer_.title = title();
+        layer_.left = left();
+        layer_.top = top();
+        layer_.flags = flags;
+        invalid_ = false;
+      }
+      return element;
+    };
+
+    Element element =
+        cacheable ? std::make_shared<LayerPlayer>(&layer_, draw) : draw();
 
     // Position and record the drawn area of the window.
     element |= reflect(box_window_);
@@ -144,7 +334,13 @@ class WindowImpl : public ComponentBase, public WindowOptions {
   }
 
   bool OnEvent(Event event) final {
+    // While being dragged, the content of the window doesn't change.
+    if (!captured_mouse_ || !drag_) {
+      invalid_ = true;
+    }
+
     if (ComponentBase::OnEvent(event)) {
+      invalid_ = true;
       return true;
     }
 
@@ -200,6 +396,9 @@ class WindowImpl : public ComponentBase, public WindowOptions {
       if (drag_) {
         left() = event.mouse().x - drag_start_x - box_.x_min;
         top() = event.mouse().y - drag_start_y - box_.y_min;
+        // The window moves itself, its layer can be drawn at the new place.
+        layer_.left = left();
+        layer_.top = top();
       }
 
       // Clamp the window size.
@@ -269,6 +468,9 @@ class WindowImpl : public ComponentBase, public WindowOptions {
   bool resize_left_hover_ = false;
   bool resize_down_hover_ = false;
   bool resize_right_hover_ = false;
+
+  Layer layer_;
+  bool invalid_ = true;  // Whether the content must be rendered again.
 };
 
 }  // namespace
@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <string>         // for string
+
+#include "ftxui/component/component.hpp"          // for Renderer, Window, Input, Vertical
+#include "ftxui/component/component_base.hpp"     // for ComponentBase
+#include "ftxui/component/component_options.hpp"  // for WindowOptions
+#include "ftxui/component/event.hpp"              // for Event
+#include "ftxui/component/mouse.hpp"              // for Mouse, Mouse::Left, Mouse::Pressed, Mouse::Released
+#include "ftxui/dom/elements.hpp"                 // for text, dbox, vbox, Element
+#include "ftxui/dom/node.hpp"                     // for Render
+#include "ftxui/screen/screen.hpp"                // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Event MouseEvent(Mouse::Motion motion, int x, int y) {
+  Mouse mouse;
+  mouse.button = Mouse::Left;
+  mouse.motion = motion;
+  mouse.shift = false;
+  mouse.meta = false;
+  mouse.control = false;
+  mouse.x = x;
+  mouse.y = y;
+  return Event::Mouse("", mouse);
+}
+
+}  // namespace
+
+TEST(WindowTest, CacheDrag) {
+  int render_count = 0;
+  int left = 1;
+  int top = 1;
+  auto window = Window({
+      .inner = Renderer([&] {
+        render_count++;
+        return text("content");
+      }),
+      .title = "title",
+      .left = &left,
+      .top = &top,
+      .width = 12,
+      .height = 3,
+      .cache = true,
+  });
+
+  Screen screen(20, 5);
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 1);
+
+  // Start dragging the window from its content.
+  window->OnEvent(MouseEvent(Mouse::Pressed, 4, 2));
+  screen.Clear();
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 2);
+
+  // Moving the window draws its recorded content again.
+  for (int i = 0; i < 3; ++i) {
+    window->OnEvent(MouseEvent(Mouse::Pressed, 5 + 2 * i, 2));
+    screen.Clear();
+    Render(screen, window->Render());
+  }
+  EXPECT_EQ(render_count, 2);
+  EXPECT_EQ(left, 6);
+  EXPECT_EQ(top, 1);
+
+  // The drawing is the same as without the cache.
+  auto reference = Window({
+      .inner = Renderer([&] { return text("content"); }),
+      .title = "title",
+      .left = &left,
+      .top = &top,
+      .width = 12,
+      .height = 3,
+  });
+  Screen expected(20, 5);
+  Render(expected, reference->Render());
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+
+  // Once released, the content is rendered again.
+  window->OnEvent(MouseEvent(Mouse::Released, 9, 2));
+  window->OnEvent(MouseEvent(Mouse::Released, 0, 0));
+  screen.Clear();
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 3);
+}
+
+TEST(WindowTest, CachePartiallyHidden) {
+  int render_count = 0;
+  auto below = Window({
+      .inner = Renderer([&] {
+        render_count++;
+        return text("below");
+      }),
+      .title = "below",
+      .left = 1,
+      .top = 0,
+      .width = 12,
+      .height = 3,
+      .cache = true,
+  });
+  auto above = Window({
+      .inner = Renderer([] { return text("above"); }),
+      .title = "above",
+      .left = 8,
+      .top = 0,
+      .width = 12,
+      .height = 3,
+  });
+
+  // The window below is partially hidden, but its recorded drawing is still
+  // used. The window above reaches the bottom right corner of the screen, so
+  // the visible part of the one below is a rectangle.
+  Screen screen(20, 3);
+  for (int i = 0; i < 3; ++i) {
+    screen.Clear();
+    Render(screen, dbox({below->Render(), above->Render()}));
+  }
+  EXPECT_EQ(render_count, 1);
+}
+
+TEST(WindowTest, CacheInput) {
+  int render_count = 0;
+  std::string first = "abcdef";
+  std::string second = "ghijkl";
+  auto inputs = Container::Vertical({Input(&first), Input(&second)});
+  int left = 1;
+  int top = 1;
+  auto window = Window({
+      .inner = Renderer(inputs,
+                        [&] {
+                          render_count++;
+                          return vbox({text("drag"), inputs->Render()});
+                        }),
+      .title = "title",
+      .left = &left,
+      .top = &top,
+      .width = 12,
+      .height = 5,
+      .cache = true,
+  });
+
+  // The content starts at (2, 2). The cursor is at the start of the first
+  // input.
+  Screen screen(30, 8);
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 1);
+  EXPECT_EQ(screen.cursor().x, 2);
+  EXPECT_EQ(screen.cursor().y, 3);
+
+  // The recorded content keeps the cursor.
+  screen.Clear();
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 1);
+  EXPECT_EQ(screen.cursor().x, 2);
+  EXPECT_EQ(screen.cursor().y, 3);
+
+  // Drag the window by 3 cells. The cursor moves with the recorded content.
+  window->OnEvent(MouseEvent(Mouse::Pressed, 3, 2));
+  screen.Clear();
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 2);
+  window->OnEvent(MouseEvent(Mouse::Pressed, 6, 2));
+  screen.Clear();
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 2);
+  EXPECT_EQ(left, 4);
+  EXPECT_EQ(screen.cursor().x, 5);
+  EXPECT_EQ(screen.cursor().y, 3);
+  window->OnEvent(MouseEvent(Mouse::Released, 6, 2));
+
+  // The boxes of the inputs were moved too: clicking on the fifth character
+  // of the second input moves the cursor there.
+  window->OnEvent(MouseEvent(Mouse::Pressed, 9, 4));
+  screen.Clear();
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 3);
+  EXPECT_EQ(screen.cursor().x, 9);
+  EXPECT_EQ(screen.cursor().y, 4);
+
+  // Moving the window from the outside draws it again.
+  left = 2;
+  screen.Clear();
+  Render(screen, window->Render());
+  EXPECT_EQ(render_count, 4);
+  EXPECT_EQ(screen.cursor().x, 7);
+  EXPECT_EQ(screen.cursor().y, 4);
+}
+
+TEST(WindowTest, CacheSqueezed) {
+  int left = 10;
+  auto make_window = [&](bool cache) {
+    return Window({
+        .inner = Renderer([] { return text("content"); }),
+        .title = "title",
+        .left = &left,
+        .top = 1,
+        .width = 12,
+        .height = 3,
+        .cache = cache,
+    });
+  };
+  auto window = make_window(true);
+  Screen screen(20, 5);
+  Render(screen, window->Render());
+
+  // A window squeezed against the side of the screen is drawn as usual.
+  screen.Clear();
+  Render(screen, window->Render());
+  Screen expected(20, 5);
+  Render(expected, make_window(false)->Render());
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,32 +1,15 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, automerge
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, automerge
+#include "ftxui/dom/style.hpp"     // for Style
+#include "ftxui/dom/styled.hpp"    // for Stylize
 
 namespace ftxui {
 
 /// @brief Enable character to be automatically merged with others nearby.
 /// @ingroup dom
 Element automerge(Element child) {
-  class Impl : public NodeDecorator {
-   public:
-    using NodeDecorator::NodeDecorator;
-
-    void Render(Screen& screen) override {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          screen.PixelAt(x, y).automerge = true;
-        }
-      }
-      Node::Render(screen);
-    }
-  };
-
-  return std::make_shared<Impl>(std::move(child));
+  return Stylize(std::move(child), Style::Set(Style::kAutomerge), {});
 }
 
 }  // namespace ftxui
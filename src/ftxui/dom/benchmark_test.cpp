@@ -1,9 +1,16 @@
+#include <algorithm>  // for clamp, max
 #include <iostream>
 #include <benchmark/benchmark.h>
 
-#include "ftxui/dom/elements.hpp"  // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
-#include "ftxui/dom/node.hpp"      // for Render
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/dom/canvas.hpp"        // for Canvas
+#include "ftxui/dom/display_list.hpp"  // for Compile, DisplayList, Render
+#include "ftxui/dom/elements.hpp"      // for gauge, separator, operator|, text, Element, hbox, vbox, blink, border, inverted
+#include "ftxui/dom/node.hpp"          // for Render
+#include "ftxui/dom/reconciler.hpp"    // for Reconciler, key
+#include "ftxui/dom/static_box.hpp"    // for static_hbox, Gauge, Separator, Text
+#include "ftxui/dom/table.hpp"         // for Table
+#include "ftxui/screen/screen.hpp"     // for Screen
+#include "ftxui/screen/terminal.hpp"   // for ColorSupport, SetColorSupport
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -76,6 +83,573 @@ BENCHMARK(BenchmarkStyle)
         benchmark::CreateDenseRange(10, 200, 20),  // Screen width.
     });
 
+static void BenchmarkTableVirtual(benchmark::State& state) {
+  const int rows = state.range(0);
+  while (state.KeepRunning()) {
+    auto table = Table(rows, 4, [](int row, int column) {
+      return std::to_string(row) + ":" + std::to_string(column);
+    });
+    table.SelectAll().Border(LIGHT);
+    table.SelectAll().Separator(LIGHT);
+    table.SelectRow(0).Decorate(bold);
+    table.SelectAll().DecorateCellsAlternateRow(inverted);
+    auto document = table.Render() | focusPositionRelative(0.f, 0.5f) | frame;
+    Screen screen(80, 40);
+    Render(screen, document);
+    screen.ToString();
+  }
+}
+BENCHMARK(BenchmarkTableVirtual)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+
+static Element StyledDocument(int size) {
+  Elements lines;
+  for (int i = 0; i < size; ++i) {
+    lines.push_back(hbox({
+        text("Test") | bold,
+        separator(),
+        text("Test") | dim | underlined,
+        separator(),
+        text("Test") | inverted | color(Color::Red),
+    }));
+  }
+  return vbox(std::move(lines)) | border;
+}
+
+static void BenchmarkRenderStyled(benchmark::State& state) {
+  auto document = StyledDocument(state.range(0));
+  Screen screen(80, state.range(0) + 2);
+  while (state.KeepRunning()) {
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkRenderStyled)->Arg(10)->Arg(100)->Arg(1000);
+
+static void BenchmarkReplayStyled(benchmark::State& state) {
+  Screen screen(80, state.range(0) + 2);
+  auto list = Compile(screen, StyledDocument(state.range(0)));
+  while (state.KeepRunning()) {
+    Render(screen, list);
+  }
+}
+BENCHMARK(BenchmarkReplayStyled)->Arg(10)->Arg(100)->Arg(1000);
+
+// A log line highlighted using |spans| pieces, drawn using an hbox of texts.
+static void BenchmarkLogHbox(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    Elements lines;
+    for (int y = 0; y < 50; ++y) {
+      Elements spans;
+      for (int i = 0; i < state.range(0); ++i) {
+        spans.push_back(text("word ") | (i % 2 ? bold : dim) |
+                        color(i % 3 ? Color::Red : Color::Blue));
+      }
+      lines.push_back(hbox(std::move(spans)));
+    }
+    Screen screen(200, 50);
+    Render(screen, vbox(std::move(lines)));
+  }
+}
+BENCHMARK(BenchmarkLogHbox)->Arg(8)->Arg(32);
+
+// Same, using a single richText per line.
+static void BenchmarkLogRichText(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    Elements lines;
+    for (int y = 0; y < 50; ++y) {
+      std::vector<Span> spans;
+      for (int i = 0; i < state.range(0); ++i) {
+        Style style = Style::Set(i % 2 ? Style::kBold : Style::kDim);
+        style.Merge(Style::Foreground(i % 3 ? Color::Red : Color::Blue));
+        spans.push_back({"word ", style, ""});
+      }
+      lines.push_back(richText(std::move(spans)));
+    }
+    Screen screen(200, 50);
+    Render(screen, vbox(std::move(lines)));
+  }
+}
+BENCHMARK(BenchmarkLogRichText)->Arg(8)->Arg(32);
+
+// Draw a framed document of |lines| lines. Only the 40 visible ones should
+// matter.
+static void BenchmarkFramedDocument(benchmark::State& state) {
+  Elements lines;
+  for (int i = 0; i < state.range(0); ++i) {
+    lines.push_back(hbox({
+        text(std::to_string(i)) | bold,
+        separator(),
+        gauge(0.5f),
+    }));
+  }
+  auto document = vbox(std::move(lines)) | focusPositionRelative(0.f, 0.5f) |
+                  vscroll_indicator | frame | border;
+  Screen screen(80, 40);
+  Render(screen, document);  // Layout.
+  while (state.KeepRunning()) {
+    document->Render(screen);
+  }
+}
+BENCHMARK(BenchmarkFramedDocument)->Arg(1'000)->Arg(10'000)->Arg(100'000);
+
+// Draw |layers| overlapping windows.
+static void BenchmarkOverlappingWindows(benchmark::State& state) {
+  Elements layers;
+  for (int i = 0; i < state.range(0); ++i) {
+    Elements lines;
+    for (int y = 0; y < 40; ++y) {
+      lines.push_back(hbox({
+          text("Line " + std::to_string(y)) | bold,
+          separator(),
+          gauge(0.5f) | color(Color::Red),
+      }));
+    }
+    layers.push_back(window(text("Window"), vbox(std::move(lines))) |
+                     clear_under);
+  }
+  auto document = dbox(std::move(layers));
+  Screen screen(80, 40);
+  Render(screen, document);  // Layout.
+  while (state.KeepRunning()) {
+    document->Render(screen);
+  }
+}
+BENCHMARK(BenchmarkOverlappingWindows)->Arg(1)->Arg(12);
+
+// Draw a dashboard where a single panel changes every frame, with or without
+// reusing the drawing of the other ones.
+static void BenchmarkReconciler(benchmark::State& state) {
+  const bool reconcile = state.range(0);
+  auto panel = [](int index, int frame) {
+    Elements lines;
+    for (int y = 0; y < 8; ++y) {
+      lines.push_back(hbox({
+          text("Value " + std::to_string(y)) | bold,
+          separator(),
+          gauge(float(y) / 8.f) | color(Color::Red),
+          text(std::to_string(frame)),
+      }));
+    }
+    return window(text("Panel " + std::to_string(index)),
+                  vbox(lines) | bgcolor(LinearGradient(Color::Blue,
+                                                       Color::Black))) |
+           size(WIDTH, EQUAL, 40) | key(std::to_string(index));
+  };
+
+  Reconciler reconciler;
+  Screen screen(160, 50);
+  int frame = 0;
+  while (state.KeepRunning()) {
+    frame++;
+    Elements rows;
+    for (int y = 0; y < 5; ++y) {
+      Elements row;
+      for (int x = 0; x < 4; ++x) {
+        const int index = y * 4 + x;
+        row.push_back(panel(index, index == 0 ? frame : 0));
+      }
+      rows.push_back(hbox(std::move(row)));
+    }
+    auto document = vbox(std::move(rows));
+    screen.Clear();
+    if (reconcile) {
+      reconciler.Render(screen, document);
+    } else {
+      Render(screen, document);
+    }
+  }
+}
+BENCHMARK(BenchmarkReconciler)->Arg(false)->Arg(true);
+
+// Build and draw a settings screen made of 40 sections, only one of them being
+// visible, with or without building the sections lazily.
+static void BenchmarkLazySections(benchmark::State& state) {
+  const bool use_lazy = state.range(0);
+  auto section = [](int index) {
+    Elements lines;
+    for (int y = 0; y < 100; ++y) {
+      lines.push_back(hbox({
+          text("Option " + std::to_string(y)) | bold,
+          separator(),
+          text("value"),
+      }));
+    }
+    return window(text("Section " + std::to_string(index)), vbox(lines));
+  };
+
+  Requirement hint;
+  hint.min_x = 40;
+  hint.min_y = 102;
+  while (state.KeepRunning()) {
+    Elements sections;
+    for (int i = 0; i < 40; ++i) {
+      if (use_lazy) {
+        sections.push_back(lazy(hint, [&, i] { return section(i); }));
+      } else {
+        sections.push_back(section(i));
+      }
+    }
+    auto document = vbox(std::move(sections)) | frame;
+    Screen screen(80, 40);
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkLazySections)->Arg(false)->Arg(true);
+
+// Build and draw 40 status bars, using hbox or static_hbox.
+static void BenchmarkStaticHBox(benchmark::State& state) {
+  const bool use_static = state.range(0);
+  while (state.KeepRunning()) {
+    Elements lines;
+    for (int i = 0; i < 40; ++i) {
+      const float value = float(i) / 40.f;
+      if (use_static) {
+        lines.push_back(static_hbox(
+            Static::Text("CPU "), Static::Gauge(value), Static::Separator(),
+            Static::Text("MEM "), Static::Gauge(1.f - value),
+            Static::Separator(), Static::Text("NET "), Static::Gauge(value)));
+      } else {
+        lines.push_back(hbox({
+            text("CPU "),
+            gauge(value),
+            separator(),
+            text("MEM "),
+            gauge(1.f - value),
+            separator(),
+            text("NET "),
+            gauge(value),
+        }));
+      }
+    }
+    auto document = vbox(std::move(lines));
+    Screen screen(80, 40);
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkStaticHBox)->Arg(false)->Arg(true);
+
+// Layout a vbox made of many lines, one of four being flexible.
+static void BenchmarkLayoutVBox(benchmark::State& state) {
+  Elements lines;
+  for (int i = 0; i < state.range(0); ++i) {
+    lines.push_back(i % 4 ? text("line") : text("line") | flex);
+  }
+  auto document = vbox(std::move(lines));
+  while (state.KeepRunning()) {
+    document->ComputeRequirement();
+    const int height = document->requirement().min_y;
+    document->SetBox(Box{0, 79, 0, height + height / 2});
+    document->SetBox(Box{0, 79, 0, height / 2});
+  }
+}
+BENCHMARK(BenchmarkLayoutVBox)->Arg(1000)->Arg(50000);
+
+// Build and draw a 500x40 grid, whose last rows are missing some cells.
+static void BenchmarkGridBox(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    std::vector<Elements> lines;
+    for (int y = 0; y < 500; ++y) {
+      Elements line;
+      for (int x = 0; x < (y < 400 ? 40 : 20); ++x) {
+        line.push_back(text(std::to_string(x * y)));
+      }
+      lines.push_back(std::move(line));
+    }
+    auto document = gridbox(std::move(lines)) | frame;
+    Screen screen(200, 50);
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkGridBox);
+
+// Build and draw 4 large panels side by side, with or without `parallel`. The
+// scaling depends on the number of cores of the machine.
+static void BenchmarkParallel(benchmark::State& state) {
+  const bool use_parallel = state.range(0);
+  auto panel = [](int index) {
+    Elements lines;
+    for (int y = 0; y < 100; ++y) {
+      lines.push_back(hbox({
+          text(std::to_string(index * y)) | bold,
+          separator(),
+          gauge(float(y) / 100.f) | color(Color::RGB(y, 100, index * 50)),
+      }));
+    }
+    return vbox(std::move(lines)) | border | flex;
+  };
+  while (state.KeepRunning()) {
+    auto document = hbox({
+        panel(0),
+        panel(1),
+        panel(2),
+        panel(3),
+    });
+    if (use_parallel) {
+      document |= parallel;
+    }
+    Screen screen(200, 100);
+    Render(screen, document);
+  }
+}
+BENCHMARK(BenchmarkParallel)->Arg(false)->Arg(true)->UseRealTime();
+
+// Apply nested decorators covering a large screen. The element is built once,
+// only the drawing is measured.
+static void BenchmarkDecoratorFill(benchmark::State& state) {
+  Element document = filler() | clear_under;
+  for (int i = 0; i < 4; ++i) {
+    document = vbox({document | flex, separator()}) | bgcolor(Color::Blue);
+    document = hbox({document | flex, text("x")}) | inverted;
+    document = document | hyperlink("https://example.com");
+  }
+  Screen screen(200, 100);
+  Render(screen, document);
+  while (state.KeepRunning()) {
+    document->Render(screen);
+  }
+}
+BENCHMARK(BenchmarkDecoratorFill);
+
+// Draw 20 panels with a gradient background, at various angles.
+static void BenchmarkLinearGradient(benchmark::State& state) {
+  Elements panels;
+  for (int i = 0; i < 20; ++i) {
+    auto gradient = LinearGradient(float(i * 18), Color::Red, Color::Blue);
+    panels.push_back(filler() | bgcolor(gradient));
+  }
+  auto document = gridbox({
+      Elements(panels.begin(), panels.begin() + 5),
+      Elements(panels.begin() + 5, panels.begin() + 10),
+      Elements(panels.begin() + 10, panels.begin() + 15),
+      Elements(panels.begin() + 15, panels.end()),
+  });
+  Screen screen(200, 60);
+  Render(screen, document);
+  while (state.KeepRunning()) {
+    document->Render(screen);
+  }
+}
+BENCHMARK(BenchmarkLinearGradient);
+
+// Build RGB colors on a terminal without true colors support. They are
+// converted to the closest color of the palette.
+static void BenchmarkColorFallback(benchmark::State& state) {
+  const Terminal::Color support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(Terminal::Color::Palette256);
+  int i = 0;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        Color::RGB(uint8_t(i), uint8_t(i * 7), uint8_t(i * 13)));
+    ++i;
+  }
+  Terminal::SetColorSupport(support);
+}
+BENCHMARK(BenchmarkColorFallback);
+
+// Plot 1M points on a canvas, and draw it.
+static void BenchmarkCanvasPoints(benchmark::State& state) {
+  const bool use_color = state.range(0);
+  while (state.KeepRunning()) {
+    Canvas c(400, 200);
+    unsigned int seed = 0;
+    for (int i = 0; i < 1'000'000; ++i) {
+      seed = seed * 1103515245u + 12345u;
+      const int x = int(seed >> 8) % 400;
+      const int y = int(seed >> 20) % 200;
+      if (use_color) {
+        c.DrawPoint(x, y, true, Color::Red);
+      } else {
+        c.DrawPointOn(x, y);
+      }
+    }
+    Screen screen(200, 50);
+    Render(screen, canvas(std::move(c)));
+  }
+}
+BENCHMARK(BenchmarkCanvasPoints)->Arg(false)->Arg(true);
+
+// Plot 1M colored samples of a series, one call per sample or in bulk.
+static void BenchmarkCanvasBulk(benchmark::State& state) {
+  const bool use_bulk = state.range(0);
+  std::vector<Canvas::Point> points;
+  std::vector<int> xs;
+  std::vector<int> ys;
+  unsigned int seed = 0;
+  int y = 100;
+  for (int i = 0; i < 1'000'000; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    y = std::clamp(y + int(seed >> 20) % 3 - 1, 0, 199);
+    points.push_back({i * 400 / 1'000'000, y});
+    xs.push_back(points.back().x);
+    ys.push_back(points.back().y);
+  }
+  while (state.KeepRunning()) {
+    Canvas c(400, 200);
+    if (use_bulk) {
+      c.DrawPointScatter(xs.data(), ys.data(), xs.size(), Color::Red);
+      c.DrawPointPolyline(points, Color::Blue);
+    } else {
+      for (size_t i = 0; i < xs.size(); ++i) {
+        c.DrawPoint(xs[i], ys[i], true, Color::Red);
+      }
+      for (size_t i = 1; i < points.size(); ++i) {
+        c.DrawPointLine(points[i - 1].x, points[i - 1].y, points[i].x,
+                        points[i].y, Color::Blue);
+      }
+    }
+    benchmark::DoNotOptimize(c.GetPixel(0, 0));
+  }
+}
+BENCHMARK(BenchmarkCanvasBulk)->Arg(false)->Arg(true);
+
+// Draw long lines, mostly outside of the canvas, as in a zoomed-in chart.
+static void BenchmarkCanvasClipping(benchmark::State& state) {
+  while (state.KeepRunning()) {
+    Canvas c(400, 200);
+    for (int i = 0; i < 1000; ++i) {
+      c.DrawPointLine(i % 400, 100, i % 400 + 40000, 100 + i - 500);
+    }
+    Screen screen(200, 50);
+    Render(screen, canvas(std::move(c)));
+  }
+}
+BENCHMARK(BenchmarkCanvasClipping);
+
+// Draw a chart with a moving cursor, rebuilding the canvas every frame or
+// keeping it across frames.
+static void BenchmarkCanvasPersistent(benchmark::State& state) {
+  const bool persistent = state.range(0);
+  auto draw_segment = [](Canvas& c, int x) {
+    c.DrawPointLine(x, 100 + (x * 37) % 80 - 40, x + 1,
+                    100 + ((x + 1) * 37) % 80 - 40, Color::Blue);
+  };
+  auto draw_chart = [&](Canvas& c) {
+    for (int x = 0; x < 400; ++x) {
+      draw_segment(c, x);
+    }
+    for (int y = 0; y < 200; y += 20) {
+      c.DrawText(0, y, std::to_string(y));
+    }
+  };
+  Canvas chart(400, 200);
+  draw_chart(chart);
+  int cursor = 0;
+  while (state.KeepRunning()) {
+    cursor = (cursor + 1) % 400;
+    Screen screen(200, 50);
+    if (persistent) {
+      // Erase the previous cursor, and draw the chart below again.
+      chart.ClearRect(cursor - 1, 0, 1, 200);
+      draw_segment(chart, cursor - 2);
+      draw_segment(chart, cursor - 1);
+      chart.DrawPointLine(cursor, 0, cursor, 199, Color::Red);
+      Render(screen, canvas(&chart));
+    } else {
+      Canvas c(400, 200);
+      draw_chart(c);
+      c.DrawPointLine(cursor, 0, cursor, 199, Color::Red);
+      Render(screen, canvas(std::move(c)));
+    }
+  }
+}
+BENCHMARK(BenchmarkCanvasPersistent)->Arg(false)->Arg(true);
+
+// Draw a 400x200 RGB image, with a block per 1x2 pixels or with DrawImage.
+static void BenchmarkCanvasImage(benchmark::State& state) {
+  const bool use_image = state.range(0);
+  const Terminal::Color support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const int width = 400;
+  const int height = 200;
+  std::vector<uint8_t> image(size_t(width * height * 3));
+  for (size_t i = 0; i < image.size(); ++i) {
+    image[i] = uint8_t(i * 7);
+  }
+  while (state.KeepRunning()) {
+    Canvas c(width, height);
+    if (use_image) {
+      c.DrawImage(0, 0, width, height, image.data(), width * 3);
+    } else {
+      for (int y = 0; y < height; y += 2) {
+        for (int x = 0; x < width; ++x) {
+          const uint8_t* pixel = &image[size_t((y * width + x) * 3)];
+          c.DrawBlock(x, y, true, Color::RGB(pixel[0], pixel[1], pixel[2]));
+        }
+      }
+    }
+    Screen screen(200, 50);
+    Render(screen, canvas(std::move(c)));
+  }
+  Terminal::SetColorSupport(support);
+}
+BENCHMARK(BenchmarkCanvasImage)->Arg(false)->Arg(true);
+
+static void BenchmarkTimeSeries(benchmark::State& state) {
+  const bool use_time_series = state.range(0);
+  TimeSeries series(1000000);
+  unsigned int seed = 0;
+  for (size_t i = 0; i < series.capacity(); ++i) {
+    seed = seed * 1103515245u + 12345u;
+    series.Push(float(seed >> 16));
+  }
+  // Scan every sample of a bucket, the way a GraphFunction would.
+  auto graph_function = [&](int width, int height) {
+    std::vector<int> output(static_cast<size_t>(width));
+    const size_t bucket = series.size() / size_t(width);
+    for (size_t x = 0; x < output.size(); ++x) {
+      float high = series[x * bucket];
+      for (size_t i = x * bucket; i < (x + 1) * bucket; ++i) {
+        high = std::max(high, series[i]);
+      }
+      output[x] = int(high * float(height) / 65536.F);
+    }
+    return output;
+  };
+  while (state.KeepRunning()) {
+    Screen screen(200, 50);
+    if (use_time_series) {
+      Render(screen, timeSeries(&series));
+    } else {
+      Render(screen, graph(graph_function));
+    }
+  }
+}
+BENCHMARK(BenchmarkTimeSeries)->Arg(false)->Arg(true);
+
+static void BenchmarkHeatmap(benchmark::State& state) {
+  const bool use_heatmap = state.range(0);
+  const Terminal::Color support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const int rows = 64;
+  const int cols = 200;
+  std::vector<float> data(size_t(rows * cols));
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = float(i * 7 % 101) / 100.f;
+  }
+  const Color low = Color::Blue;
+  const Color high = Color::Red;
+  while (state.KeepRunning()) {
+    Screen screen(cols, rows / 2);
+    if (use_heatmap) {
+      Render(screen, heatmap(data.data(), rows, cols, ColorMap(low, high)));
+    } else {
+      // One element per cell, showing every other row.
+      Elements lines;
+      for (int y = 0; y < rows; y += 2) {
+        Elements cells;
+        for (int x = 0; x < cols; ++x) {
+          const float value = data[size_t(y * cols + x)];
+          cells.push_back(text(" ") |
+                          bgcolor(Color::Interpolate(value, low, high)));
+        }
+        lines.push_back(hbox(std::move(cells)));
+      }
+      Render(screen, vbox(std::move(lines)));
+    }
+  }
+  Terminal::SetColorSupport(support);
+}
+BENCHMARK(BenchmarkHeatmap)->Arg(false)->Arg(true);
+
 }  // namespace ftxui
 // NOLINTEND
 
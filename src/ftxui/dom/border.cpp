@@ -1,4 +1,4 @@
-#include <algorithm>               // for max
+#include <algorithm>               // for max, min
 #include <array>                   // for array
 #include <ftxui/screen/color.hpp>  // for Color
 #include <memory>    // for allocator, make_shared, __shared_ptr_access
@@ -8,6 +8,7 @@
 #include <vector>    // for __alloc_traits<>::value_type
 
 #include "ftxui/dom/elements.hpp"  // for unpack, Element, Decorator, BorderStyle, ROUNDED, borderStyled, Elements, DASHED, DOUBLE, EMPTY, HEAVY, LIGHT, border, borderDashed, borderDouble, borderEmpty, borderHeavy, borderLight, borderRounded, borderWith, window
+#include "ftxui/dom/hash.hpp"      // for HashValue
 #include "ftxui/dom/node.hpp"      // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -86,7 +87,10 @@ class Border : public Node {
     screen.at(box_.x_min, box_.y_max) = charset_[2];  // NOLINT
     screen.at(box_.x_max, box_.y_max) = charset_[3];  // NOLINT
 
-    for (int x = box_.x_min + 1; x < box_.x_max; ++x) {
+    // Only the visible part of the edges is drawn.
+    const Box visible = Box::Intersection(box_, screen.stencil);
+    for (int x = std::max(box_.x_min + 1, visible.x_min);
+         x < std::min(box_.x_max, visible.x_max + 1); ++x) {
       Pixel& p1 = screen.PixelAt(x, box_.y_min);
       Pixel& p2 = screen.PixelAt(x, box_.y_max);
       p1.character = charset_[4];  // NOLINT
@@ -94,7 +98,8 @@ class Border : public Node {
       p1.automerge = true;
       p2.automerge = true;
     }
-    for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
+    for (int y = std::max(box_.y_min + 1, visible.y_min);
+         y < std::min(box_.y_max, visible.y_max + 1); ++y) {
       Pixel& p3 = screen.PixelAt(box_.x_min, y);
       Pixel& p4 = screen.PixelAt(box_.x_max, y);
       p3.character = charset_[5];  // NOLINT
@@ -120,6 +125,15 @@ class Border : public Node {
       }
     }
   }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, &charset_);
+    HashValue(hash, foreground_color_.has_value());
+    if (foreground_color_) {
+      HashValue(hash, *foreground_color_);
+    }
+    return HashChildren(hash);
+  }
 };
 
 // For reference, here is the charset for normal border:
@@ -177,15 +191,24 @@ class BorderPixel : public Node {
     screen.PixelAt(box_.x_min, box_.y_max) = pixel_;
     screen.PixelAt(box_.x_max, box_.y_max) = pixel_;
 
-    for (int x = box_.x_min + 1; x < box_.x_max; ++x) {
+    // Only the visible part of the edges is drawn.
+    const Box visible = Box::Intersection(box_, screen.stencil);
+    for (int x = std::max(box_.x_min + 1, visible.x_min);
+         x < std::min(box_.x_max, visible.x_max + 1); ++x) {
       screen.PixelAt(x, box_.y_min) = pixel_;
       screen.PixelAt(x, box_.y_max) = pixel_;
     }
-    for (int y = box_.y_min + 1; y < box_.y_max; ++y) {
+    for (int y = std::max(box_.y_min + 1, visible.y_min);
+         y < std::min(box_.y_max, visible.y_max + 1); ++y) {
       screen.PixelAt(box_.x_min, y) = pixel_;
       screen.PixelAt(box_.x_max, y) = pixel_;
     }
   }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, pixel_);
+    return HashChildren(hash);
+  }
 };
 
 /// @brief Draw a border around the element.
@@ -4,84 +4,64 @@
 
 namespace ftxui::box_helper {
 
-namespace {
-// Called when the size allowed is greater than the requested size. This
-// distributes the extra spaces toward the flexible elements, in relative
-// proportions.
-void ComputeGrow(std::vector<Element>* elements,
-                 int extra_space,
-                 int flex_grow_sum) {
-  for (Element& element : *elements) {
-    const int added_space =
-        extra_space * element.flex_grow / std::max(flex_grow_sum, 1);
-    extra_space -= added_space;
-    flex_grow_sum -= element.flex_grow;
-    element.size = element.min_size + added_space;
-  }
-}
-
-// Called when the size allowed is lower than the requested size, and the
-// shrinkable element can absorbe the (negative) extra_space. This distribute
-// the extra_space toward those.
-void ComputeShrinkEasy(std::vector<Element>* elements,
-                       int extra_space,
-                       int flex_shrink_sum) {
-  for (Element& element : *elements) {
-    const int added_space = extra_space * element.min_size *
-                            element.flex_shrink / std::max(flex_shrink_sum, 1);
-    extra_space -= added_space;
-    flex_shrink_sum -= element.flex_shrink * element.min_size;
-    element.size = element.min_size + added_space;
+Distribution::Distribution(const Sums& sums, int target_size) {
+  extra_space_ = target_size - sums.size;
+  if (extra_space_ >= 0) {
+    // The size allowed is greater than the requested size. This distributes
+    // the extra spaces toward the flexible elements, in relative proportions.
+    mode_ = Mode::Grow;
+    sum_ = sums.flex_grow;
+  } else if (sums.flex_shrink_size + extra_space_ >= 0) {
+    // The size allowed is lower than the requested size, and the shrinkable
+    // element can absorbe the (negative) extra_space. This distribute the
+    // extra_space toward those.
+    mode_ = Mode::ShrinkEasy;
+    sum_ = sums.flex_shrink;
+  } else {
+    // The size allowed is lower than the requested size, and the shrinkable
+    // element can not absorbe the (negative) extra_space. This assign zero to
+    // shrinkable elements and distribute the remaining (negative) extra_space
+    // toward the other non shrinkable elements.
+    mode_ = Mode::ShrinkHard;
+    extra_space_ += sums.flex_shrink_size;
+    sum_ = sums.size - sums.flex_shrink_size;
   }
 }
 
-// Called when the size allowed is lower than the requested size, and the
-// shrinkable element can not absorbe the (negative) extra_space. This assign
-// zero to shrinkable elements and distribute the remaining (negative)
-// extra_space toward the other non shrinkable elements.
-void ComputeShrinkHard(std::vector<Element>* elements,
-                       int extra_space,
-                       int size) {
-  for (Element& element : *elements) {
-    if (element.flex_shrink != 0) {
-      element.size = 0;
-      continue;
-    }
+int Distribution::Next(const Element& element) {
+  int added_space = 0;
+  switch (mode_) {
+    case Mode::Grow:
+      added_space = extra_space_ * element.flex_grow / std::max(sum_, 1);
+      sum_ -= element.flex_grow;
+      break;
 
-    const int added_space = extra_space * element.min_size / std::max(1, size);
-    extra_space -= added_space;
-    size -= element.min_size;
+    case Mode::ShrinkEasy:
+      added_space = extra_space_ * element.min_size * element.flex_shrink /
+                    std::max(sum_, 1);
+      sum_ -= element.flex_shrink * element.min_size;
+      break;
 
-    element.size = element.min_size + added_space;
+    case Mode::ShrinkHard:
+      if (element.flex_shrink != 0) {
+        return 0;
+      }
+      added_space = extra_space_ * element.min_size / std::max(sum_, 1);
+      sum_ -= element.min_size;
+      break;
   }
+  extra_space_ -= added_space;
+  return element.min_size + added_space;
 }
 
-}  // namespace
-
 void Compute(std::vector<Element>* elements, int target_size) {
-  int size = 0;
-  int flex_grow_sum = 0;
-  int flex_shrink_sum = 0;
-  int flex_shrink_size = 0;
-
-  for (auto& element : *elements) {
-    flex_grow_sum += element.flex_grow;
-    flex_shrink_sum += element.min_size * element.flex_shrink;
-    if (element.flex_shrink != 0) {
-      flex_shrink_size += element.min_size;
-    }
-    size += element.min_size;
+  Sums sums;
+  for (const Element& element : *elements) {
+    sums.Add(element);
   }
-
-  const int extra_space = target_size - size;
-  if (extra_space >= 0) {
-    ComputeGrow(elements, extra_space, flex_grow_sum);
-  } else if (flex_shrink_size + extra_space >= 0) {
-    ComputeShrinkEasy(elements, extra_space, flex_shrink_sum);
-
-  } else {
-    ComputeShrinkHard(elements, extra_space + flex_shrink_size,
-                      size - flex_shrink_size);
+  Distribution distribution(sums, target_size);
+  for (Element& element : *elements) {
+    element.size = distribution.Next(element);
   }
 }
 
@@ -16,6 +16,45 @@ struct Element {
   int size = 0;
 };
 
+// Sums over the elements to lay out. They can be accumulated while computing
+// the requirements, so that laying out the elements takes a single pass.
+struct Sums {
+  int size = 0;
+  int flex_grow = 0;
+  int flex_shrink = 0;
+  int flex_shrink_size = 0;
+
+  void Add(const Element& element) {
+    size += element.min_size;
+    flex_grow += element.flex_grow;
+    flex_shrink += element.min_size * element.flex_shrink;
+    if (element.flex_shrink != 0) {
+      flex_shrink_size += element.min_size;
+    }
+  }
+};
+
+// Distribute |target_size| among the elements summed in |sums|, one element
+// after the other, without storing them. The elements must be given to Next()
+// in the same order.
+class Distribution {
+ public:
+  Distribution(const Sums& sums, int target_size);
+
+  // Return the size of the next element.
+  int Next(const Element& element);
+
+ private:
+  enum class Mode {
+    Grow,
+    ShrinkEasy,
+    ShrinkHard,
+  };
+  Mode mode_;
+  int extra_space_;
+  int sum_;
+};
+
 void Compute(std::vector<Element>* elements, int target_size);
 
 }  // namespace box_helper
@@ -2,19 +2,20 @@
 
 #include <algorithm>               // for max, min
 #include <cmath>                   // for abs
-#include <cstdint>                 // for uint8_t
+#include <cstddef>                 // for ptrdiff_t, size_t
+#include <cstdint>                 // for int64_t, uint16_t, uint8_t
 #include <cstdlib>                 // for abs
 #include <ftxui/screen/color.hpp>  // for Color
-#include <map>                     // for map
 #include <memory>                  // for make_shared
-#include <utility>                 // for move, pair
+#include <string>                  // for string
+#include <utility>                 // for move
 #include <vector>                  // for vector
 
 #include "ftxui/dom/elements.hpp"     // for Element, canvas
 #include "ftxui/dom/node.hpp"         // for Node
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
+#include "ftxui/screen/screen.hpp"    // for Pixel, PixelSpan, Screen
 #include "ftxui/screen/string.hpp"    // for Utf8ToGlyphs
 #include "ftxui/util/ref.hpp"         // for ConstRef
 
@@ -22,60 +23,185 @@ namespace ftxui {
 
 namespace {
 
-// Base UTF8 pattern:
-// 11100010 10100000 10000000 // empty
-
-// Pattern for the individuel dots:
-// ┌──────┬───────┐
-// │dot1  │ dot4  │
-// ├──────┼───────┤
-// │dot2  │ dot5  │
-// ├──────┼───────┤
-// │dot3  │ dot6  │
-// ├──────┼───────┤
-// │dot0-1│ dot0-2│
-// └──────┴───────┘
-// 11100010 10100000 10000001 // dot1
-// 11100010 10100000 10000010 // dot2
-// 11100010 10100000 10000100 // dot3
-// 11100010 10100001 10000000 // dot0-1
-// 11100010 10100000 10001000 // dot4
-// 11100010 10100000 10010000 // dot5
-// 11100010 10100000 10100000 // dot6
-// 11100010 10100010 10000000 // dot0-2
+// The braille characters are U+2800 + mask, with one bit per dot:
+// ┌──────┬──────┐
+// │ 0x01 │ 0x08 │
+// ├──────┼──────┤
+// │ 0x02 │ 0x10 │
+// ├──────┼──────┤
+// │ 0x04 │ 0x20 │
+// ├──────┼──────┤
+// │ 0x40 │ 0x80 │
+// └──────┴──────┘
 
 // NOLINTNEXTLINE
-uint8_t g_map_braille[2][4][2] = {
-    {
-        {0b00000000, 0b00000001},  // NOLINT | dot1
-        {0b00000000, 0b00000010},  // NOLINT | dot2
-        {0b00000000, 0b00000100},  // NOLINT | dot3
-        {0b00000001, 0b00000000},  // NOLINT | dot0-1
-    },
-    {
-        {0b00000000, 0b00001000},  // NOLINT | dot4
-        {0b00000000, 0b00010000},  // NOLINT | dot5
-        {0b00000000, 0b00100000},  // NOLINT | dot6
-        {0b00000010, 0b00000000},  // NOLINT | dot0-2
-    },
+const uint8_t g_map_braille[2][4] = {
+    {0x01, 0x02, 0x04, 0x40},  // NOLINT
+    {0x08, 0x10, 0x20, 0x80},  // NOLINT
 };
 
+std::string Braille(uint8_t mask) {
+  return {
+      char(0xE2),                  // NOLINT
+      char(0xA0 | (mask >> 6)),    // NOLINT
+      char(0x80 | (mask & 0x3F)),  // NOLINT
+  };
+}
+
 // NOLINTNEXTLINE
 std::vector<std::string> g_map_block = {
     " ", "▘", "▖", "▌", "▝", "▀", "▞", "▛",
     "▗", "▚", "▄", "▙", "▐", "▜", "▟", "█",
 };
 
-// NOLINTNEXTLINE
-const std::map<std::string, uint8_t> g_map_block_inversed = {
-    {" ", 0b0000}, {"▘", 0b0001}, {"▖", 0b0010}, {"▌", 0b0011},
-    {"▝", 0b0100}, {"▀", 0b0101}, {"▞", 0b0110}, {"▛", 0b0111},
-    {"▗", 0b1000}, {"▚", 0b1001}, {"▄", 0b1010}, {"▙", 0b1011},
-    {"▐", 0b1100}, {"▜", 0b1101}, {"▟", 0b1110}, {"█", 0b1111},
-};
+// The halves of the cells drawn by DrawImage().
+constexpr uint8_t kTopHalf = 1;
+constexpr uint8_t kBottomHalf = 2;
+constexpr uint8_t kBothHalves = kTopHalf | kBottomHalf;
+
+// The character of a cell drawn by DrawImage(). Its foreground color is the
+// one of the top half, unless only the bottom one is drawn.
+const char* HalfBlock(uint8_t mask) {
+  return mask == kBottomHalf ? "▄" : "▀";
+}
 
 constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 
+// The first step in [begin, end] where |reached| holds, or end + 1. It must not
+// hold before some step, and hold after.
+template <typename Predicate>
+int64_t FirstStep(int64_t begin, int64_t end, Predicate reached) {
+  ++end;
+  while (begin < end) {
+    const int64_t middle = begin + (end - begin) / 2;
+    if (reached(middle)) {
+      end = middle;
+    } else {
+      begin = middle + 1;
+    }
+  }
+  return begin;
+}
+
+// Call |plot| on |count| dots of a Bresenham line, starting from (x, y) with
+// the given error term.
+template <typename Int, typename Plot>
+void WalkLine(Int x,
+              Int y,
+              Int error,
+              Int dx,
+              Int dy,
+              int sx,
+              int sy,
+              int64_t count,
+              Plot& plot) {
+  for (int64_t i = 0; i < count; ++i) {
+    plot(int(x), int(y));
+    if (2 * error >= -dy) {
+      error -= dy;
+      x += sx;
+    }
+    if (2 * error <= dx) {
+      error += dx;
+      y += sy;
+    }
+  }
+}
+
+// Call |plot| on every dot of the line from (x1, y1) to (x2, y2) inside the
+// rectangle [0, width) x [0, height).
+//
+// The dots are the ones of the Bresenham algorithm. Both coordinates of the
+// dot at a given step have a closed form and vary monotonically, so the steps
+// inside the rectangle are found by binary search, and only those are walked.
+template <typename Plot>
+void ForEachLineDot(int x1,
+                    int y1,
+                    int x2,
+                    int y2,
+                    int width,
+                    int height,
+                    Plot plot) {
+  auto inside = [&](int x, int y) {
+    return x >= 0 && x < width && y >= 0 && y < height;
+  };
+  const int sx = x1 < x2 ? 1 : -1;
+  const int sy = y1 < y2 ? 1 : -1;
+
+  // The whole line is visible. The last dot is always (x2, y2), drawn
+  // separately.
+  if (inside(x1, y1) && inside(x2, y2)) {
+    const int dx = std::abs(x2 - x1);
+    const int dy = std::abs(y2 - y1);
+    WalkLine(x1, y1, dx - dy, dx, dy, sx, sy, std::max(dx, dy), plot);
+    plot(x2, y2);
+    return;
+  }
+
+  const int64_t dx = std::abs(int64_t(x2) - x1);
+  const int64_t dy = std::abs(int64_t(y2) - y1);
+  const int64_t length = std::max(dx, dy);
+
+  struct Dot {
+    int64_t x;
+    int64_t y;
+    int64_t error;
+  };
+  // The dot at |step|, and the error term of the algorithm. The coordinate
+  // along the major axis moves at every step, the other one moves k times:
+  //   k = ((2 * step + 2) * dy + dx) / (2 * dx)  when dx >= dy,
+  //   k = (2 * step * dx + dy) / (2 * dy)        otherwise.
+  // The product of a step and a delta doesn't fit in 64 bits for coordinates
+  // far away from the canvas. It is divided first, as product = q * d + r, so
+  // that only the unsigned product is computed, which always fits.
+  auto dot_at = [&](int64_t step) {
+    if (dx >= dy) {
+      if (dx == 0) {
+        return Dot{x1 + sx * step, y1, 0};
+      }
+      const uint64_t product = uint64_t(step + 1) * uint64_t(dy);
+      const auto q = int64_t(product / uint64_t(dx));
+      const auto r = int64_t(product % uint64_t(dx));
+      const int64_t round = 2 * r >= dx ? 1 : 0;
+      if (q + round > step) {
+        return Dot{x1 + sx * step, y1 + sy * step,
+                   dx - dy + step * (dx - dy)};
+      }
+      return Dot{x1 + sx * step, y1 + sy * (q + round), dx + round * dx - r};
+    }
+    const uint64_t product = uint64_t(step) * uint64_t(dx);
+    const auto q = int64_t(product / uint64_t(dy));
+    const auto r = int64_t(product % uint64_t(dy));
+    const int64_t round = 2 * r >= dy ? 1 : 0;
+    return Dot{x1 + sx * (q + round), y1 + sy * step,
+               dx - dy + r - round * dy};
+  };
+  auto entered = [](int64_t value, int direction, int size) {
+    return direction > 0 ? value >= 0 : value < size;
+  };
+  auto exited = [](int64_t value, int direction, int size) {
+    return direction > 0 ? value >= size : value < 0;
+  };
+
+  const int64_t first = std::max(
+      FirstStep(0, length - 1,
+                [&](int64_t i) { return entered(dot_at(i).x, sx, width); }),
+      FirstStep(0, length - 1,
+                [&](int64_t i) { return entered(dot_at(i).y, sy, height); }));
+  const int64_t end = std::min(
+      FirstStep(0, length - 1,
+                [&](int64_t i) { return exited(dot_at(i).x, sx, width); }),
+      FirstStep(0, length - 1,
+                [&](int64_t i) { return exited(dot_at(i).y, sy, height); }));
+  if (first < end) {
+    const Dot dot = dot_at(first);
+    WalkLine(dot.x, dot.y, dot.error, dx, dy, sx, sy, end - first, plot);
+  }
+  if (inside(x2, y2)) {
+    plot(x2, y2);
+  }
+}
+
 }  // namespace
 
 /// @brief Constructor.
@@ -84,14 +210,82 @@ constexpr auto nostyle = [](Pixel& /*pixel*/) {};
 Canvas::Canvas(int width, int height)
     : width_(width),
       height_(height),
-      storage_(width_ * height_ / 8 /* NOLINT */) {}
+      cells_x_((width + 1) / 2),
+      cells_y_((height + 3) / 4),
+      cells_(size_t(cells_x_ * cells_y_)) {}
 
 /// @brief Get the content of a cell.
 /// @param x the x coordinate of the cell.
 /// @param y the y coordinate of the cell.
 Pixel Canvas::GetPixel(int x, int y) const {
-  auto it = storage_.find(XY{x, y});
-  return (it == storage_.end()) ? Pixel{} : it->second.content;
+  if (x < 0 || x >= cells_x_ || y < 0 || y >= cells_y_) {
+    return Pixel{};
+  }
+  const size_t index = size_t(y) * size_t(cells_x_) + size_t(x);
+  Pixel pixel = styles_.empty() ? Pixel{} : styles_[index];
+  const Cell& cell = cells_[index];
+  switch (cell.type) {
+    case CellType::kBraille:
+      pixel.character = Braille(cell.mask);
+      break;
+    case CellType::kBlock:
+      pixel.character = g_map_block[cell.mask];
+      break;
+    case CellType::kText:
+      break;
+    case CellType::kHalfBlock:
+      pixel.character = HalfBlock(cell.mask);
+      if (cell.mask == kBothHalves) {
+        pixel.background_color = cell.background;
+      }
+      break;
+  }
+  if (cell.has_color) {
+    pixel.foreground_color = cell.color;
+  }
+  return pixel;
+}
+
+Canvas::Cell& Canvas::BrailleCell(int x, int y) {
+  Cell& cell = cells_[Index(x, y)];
+  cell.dirty = true;
+  if (cell.type != CellType::kBraille) {
+    cell.type = CellType::kBraille;
+    cell.mask = 0;
+  }
+  return cell;
+}
+
+Canvas::Cell& Canvas::BlockCell(int x, int y) {
+  Cell& cell = cells_[Index(x, y)];
+  cell.dirty = true;
+  if (cell.type != CellType::kBlock) {
+    cell.type = CellType::kBlock;
+    cell.mask = 0;
+  }
+  return cell;
+}
+
+Pixel& Canvas::StyleAt(size_t index) {
+  if (styles_.empty()) {
+    styles_.resize(cells_.size());
+  }
+  // The style is about to be modified: move the color of the cell into it.
+  Cell& cell = cells_[index];
+  cell.dirty = true;
+  if (cell.has_color) {
+    styles_[index].foreground_color = cell.color;
+    cell.has_color = false;
+  }
+  // The same for the half blocks, which become text.
+  if (cell.type == CellType::kHalfBlock) {
+    styles_[index].character = HalfBlock(cell.mask);
+    if (cell.mask == kBothHalves) {
+      styles_[index].background_color = cell.background;
+    }
+    cell.type = CellType::kText;
+  }
+  return styles_[index];
 }
 
 /// @brief Draw a braille dot.
@@ -108,6 +302,10 @@ void Canvas::DrawPoint(int x, int y, bool value) {
 /// @param value whether the dot is filled or not.
 /// @param color the color of the dot.
 void Canvas::DrawPoint(int x, int y, bool value, const Color& color) {
+  if (value) {
+    Plot(x, y, &color);
+    return;
+  }
   DrawPoint(x, y, value, [color](Pixel& p) { p.foreground_color = color; });
 }
 
@@ -132,14 +330,7 @@ void Canvas::DrawPointOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 bytes.
-    cell.type = CellType::kBraille;
-  }
-
-  cell.content.character[1] |= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] |= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  BrailleCell(x, y).mask |= g_map_braille[x % 2][y % 4];
 }
 
 /// @brief Erase a braille dot.
@@ -149,14 +340,7 @@ void Canvas::DrawPointOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
-  }
-
-  cell.content.character[1] &= ~(g_map_braille[x % 2][y % 4][0]);  // NOLINT
-  cell.content.character[2] &= ~(g_map_braille[x % 2][y % 4][1]);  // NOLINT
+  BrailleCell(x, y).mask &= ~g_map_braille[x % 2][y % 4];
 }
 
 /// @brief Toggle a braille dot. A filled one will be erased, and the other will
@@ -167,14 +351,7 @@ void Canvas::DrawPointToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBraille) {
-    cell.content.character = "⠀";  // 3 byt
-    cell.type = CellType::kBraille;
-  }
-
-  cell.content.character[1] ^= g_map_braille[x % 2][y % 4][0];  // NOLINT
-  cell.content.character[2] ^= g_map_braille[x % 2][y % 4][1];  // NOLINT
+  BrailleCell(x, y).mask ^= g_map_braille[x % 2][y % 4];
 }
 
 /// @brief Draw a line made of braille dots.
@@ -183,7 +360,7 @@ void Canvas::DrawPointToggle(int x, int y) {
 /// @param x2 the x coordinate of the second dot.
 /// @param y2 the y coordinate of the second dot.
 void Canvas::DrawPointLine(int x1, int y1, int x2, int y2) {
-  DrawPointLine(x1, y1, x2, y2, [](Pixel& /*pixel*/) {});
+  PlotLine(x1, y1, x2, y2, nullptr);
 }
 
 /// @brief Draw a line made of braille dots.
@@ -193,8 +370,7 @@ void Canvas::DrawPointLine(int x1, int y1, int x2, int y2) {
 /// @param y2 the y coordinate of the second dot.
 /// @param color the color of the line.
 void Canvas::DrawPointLine(int x1, int y1, int x2, int y2, const Color& color) {
-  DrawPointLine(x1, y1, x2, y2,
-                [color](Pixel& p) { p.foreground_color = color; });
+  PlotLine(x1, y1, x2, y2, &color);
 }
 
 /// @brief Draw a line made of braille dots.
@@ -208,32 +384,8 @@ void Canvas::DrawPointLine(int x1,
                            int x2,
                            int y2,
                            const Stylizer& style) {
-  const int dx = std::abs(x2 - x1);
-  const int dy = std::abs(y2 - y1);
-  const int sx = x1 < x2 ? 1 : -1;
-  const int sy = y1 < y2 ? 1 : -1;
-  const int length = std::max(dx, dy);
-
-  if (!IsIn(x1, y1) && !IsIn(x2, y2)) {
-    return;
-  }
-  if (dx + dx > width_ * height_) {
-    return;
-  }
-
-  int error = dx - dy;
-  for (int i = 0; i < length; ++i) {
-    DrawPoint(x1, y1, true, style);
-    if (2 * error >= -dy) {
-      error -= dy;
-      x1 += sx;
-    }
-    if (2 * error <= dx) {
-      error += dx;
-      y1 += sy;
-    }
-  }
-  DrawPoint(x2, y2, true, style);
+  ForEachLineDot(x1, y1, x2, y2, width_, height_,
+                 [&](int x, int y) { DrawPoint(x, y, true, style); });
 }
 
 /// @brief Draw a circle made of braille dots.
@@ -402,10 +554,15 @@ void Canvas::DrawPointEllipseFilled(int x1,
   int dy = x * x;
   int err = dx + dy;
 
+  // Only the part of the spans inside the canvas is drawn.
+  auto row_in = [&](int yy) { return yy >= 0 && yy < height_; };
   do {
-    for (int xx = x1 + x; xx <= x1 - x; ++xx) {
-      DrawPoint(xx, y1 + y, true, s);
-      DrawPoint(xx, y1 - y, true, s);
+    if (row_in(y1 + y) || row_in(y1 - y)) {
+      const int x_max = std::min(x1 - x, width_ - 1);
+      for (int xx = std::max(x1 + x, 0); xx <= x_max; ++xx) {
+        DrawPoint(xx, y1 + y, true, s);
+        DrawPoint(xx, y1 - y, true, s);
+      }
     }
     e2 = 2 * err;
     if (e2 >= dx) {
@@ -418,13 +575,102 @@ void Canvas::DrawPointEllipseFilled(int x1,
     }
   } while (x <= 0);
 
+  if (x1 < 0 || x1 >= width_) {
+    return;
+  }
   while (y++ < r2) {
-    for (int yy = y1 - y; yy <= y1 + y; ++yy) {
+    const int y_max = std::min(y1 + y, height_ - 1);
+    for (int yy = std::max(y1 - y, 0); yy <= y_max; ++yy) {
       DrawPoint(x1, yy, true, s);
     }
   }
 }
 
+/// @brief Draw many braille dots.
+/// @param points the coordinates of the dots.
+void Canvas::DrawPoints(const std::vector<Point>& points) {
+  for (const Point& point : points) {
+    Plot(point.x, point.y, nullptr);
+  }
+}
+
+/// @brief Draw many braille dots.
+/// @param points the coordinates of the dots.
+/// @param color the color of the dots.
+void Canvas::DrawPoints(const std::vector<Point>& points, const Color& color) {
+  for (const Point& point : points) {
+    Plot(point.x, point.y, &color);
+  }
+}
+
+/// @brief Draw lines made of braille dots, joining consecutive points.
+/// @param points the points to join.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points) {
+  for (size_t i = 1; i < points.size(); ++i) {
+    PlotLine(points[i - 1].x, points[i - 1].y, points[i].x, points[i].y,
+             nullptr);
+  }
+  if (points.size() == 1) {
+    Plot(points[0].x, points[0].y, nullptr);
+  }
+}
+
+/// @brief Draw lines made of braille dots, joining consecutive points.
+/// @param points the points to join.
+/// @param color the color of the lines.
+void Canvas::DrawPointPolyline(const std::vector<Point>& points,
+                               const Color& color) {
+  for (size_t i = 1; i < points.size(); ++i) {
+    PlotLine(points[i - 1].x, points[i - 1].y, points[i].x, points[i].y,
+             &color);
+  }
+  if (points.size() == 1) {
+    Plot(points[0].x, points[0].y, &color);
+  }
+}
+
+/// @brief Draw many braille dots, from separate arrays of coordinates.
+/// @param xs the x coordinates of the dots.
+/// @param ys the y coordinates of the dots.
+/// @param count the number of dots.
+void Canvas::DrawPointScatter(const int* xs, const int* ys, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    Plot(xs[i], ys[i], nullptr);
+  }
+}
+
+/// @brief Draw many braille dots, from separate arrays of coordinates.
+/// @param xs the x coordinates of the dots.
+/// @param ys the y coordinates of the dots.
+/// @param count the number of dots.
+/// @param color the color of the dots.
+void Canvas::DrawPointScatter(const int* xs,
+                              const int* ys,
+                              size_t count,
+                              const Color& color) {
+  for (size_t i = 0; i < count; ++i) {
+    Plot(xs[i], ys[i], &color);
+  }
+}
+
+void Canvas::Plot(int x, int y, const Color* color) {
+  if (!IsIn(x, y)) {
+    return;
+  }
+  Cell& cell = BrailleCell(x, y);
+  cell.mask |= g_map_braille[x % 2][y % 4];
+  if (color) {
+    cell.color = *color;
+    cell.has_color = true;
+  }
+}
+
+// Same as DrawPointLine().
+void Canvas::PlotLine(int x1, int y1, int x2, int y2, const Color* color) {
+  ForEachLineDot(x1, y1, x2, y2, width_, height_,
+                 [&](int x, int y) { Plot(x, y, color); });
+}
+
 /// @brief Draw a block.
 /// @param x the x coordinate of the block.
 /// @param y the y coordinate of the block.
@@ -463,17 +709,8 @@ void Canvas::DrawBlockOn(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  y /= 2;
-  Cell& cell = storage_[XY{x / 2, y / 2}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
-
-  const uint8_t bit = (x % 2) * 2 + y % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value |= 1U << bit;
-  cell.content.character = g_map_block[value];
+  const uint8_t bit = (x % 2) * 2 + (y / 2) % 2;
+  BlockCell(x, y).mask |= 1U << bit;
 }
 
 /// @brief Erase a block.
@@ -483,17 +720,8 @@ void Canvas::DrawBlockOff(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
-  y /= 2;
-
-  const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value &= ~(1U << bit);
-  cell.content.character = g_map_block[value];
+  const uint8_t bit = ((y / 2) % 2) * 2 + x % 2;
+  BlockCell(x, y).mask &= ~(1U << bit);
 }
 
 /// @brief Toggle a block. If it is filled, it will be erased. If it is empty,
@@ -504,17 +732,8 @@ void Canvas::DrawBlockToggle(int x, int y) {
   if (!IsIn(x, y)) {
     return;
   }
-  Cell& cell = storage_[XY{x / 2, y / 4}];
-  if (cell.type != CellType::kBlock) {
-    cell.content.character = " ";
-    cell.type = CellType::kBlock;
-  }
-  y /= 2;
-
-  const uint8_t bit = (y % 2) * 2 + x % 2;
-  uint8_t value = g_map_block_inversed.at(cell.content.character);
-  value ^= 1U << bit;
-  cell.content.character = g_map_block[value];
+  const uint8_t bit = ((y / 2) % 2) * 2 + x % 2;
+  BlockCell(x, y).mask ^= 1U << bit;
 }
 
 /// @brief Draw a line made of block characters.
@@ -548,35 +767,9 @@ void Canvas::DrawBlockLine(int x1,
                            int x2,
                            int y2,
                            const Stylizer& style) {
-  y1 /= 2;
-  y2 /= 2;
-
-  const int dx = std::abs(x2 - x1);
-  const int dy = std::abs(y2 - y1);
-  const int sx = x1 < x2 ? 1 : -1;
-  const int sy = y1 < y2 ? 1 : -1;
-  const int length = std::max(dx, dy);
-
-  if (!IsIn(x1, y1) && !IsIn(x2, y2)) {
-    return;
-  }
-  if (dx + dx > width_ * height_) {
-    return;
-  }
-
-  int error = dx - dy;
-  for (int i = 0; i < length; ++i) {
-    DrawBlock(x1, y1 * 2, true, style);
-    if (2 * error >= -dy) {
-      error -= dy;
-      x1 += sx;
-    }
-    if (2 * error <= dx) {
-      error += dx;
-      y1 += sy;
-    }
-  }
-  DrawBlock(x2, y2 * 2, true, style);
+  // The blocks are 2 dots high.
+  ForEachLineDot(x1, y1 / 2, x2, y2 / 2, width_, (height_ + 1) / 2,
+                 [&](int x, int y) { DrawBlock(x, y * 2, true, style); });
 }
 
 /// @brief Draw a circle made of block characters.
@@ -749,10 +942,15 @@ void Canvas::DrawBlockEllipseFilled(int x1,
   int dy = x * x;
   int err = dx + dy;
 
+  // Only the part of the spans inside the canvas is drawn.
+  auto row_in = [&](int yy) { return yy >= 0 && 2 * yy < height_; };
   do {
-    for (int xx = x1 + x; xx <= x1 - x; ++xx) {
-      DrawBlock(xx, 2 * (y1 + y), true, s);
-      DrawBlock(xx, 2 * (y1 - y), true, s);
+    if (row_in(y1 + y) || row_in(y1 - y)) {
+      const int x_max = std::min(x1 - x, width_ - 1);
+      for (int xx = std::max(x1 + x, 0); xx <= x_max; ++xx) {
+        DrawBlock(xx, 2 * (y1 + y), true, s);
+        DrawBlock(xx, 2 * (y1 - y), true, s);
+      }
     }
     e2 = 2 * err;
     if (e2 >= dx) {
@@ -806,19 +1004,238 @@ void Canvas::DrawText(int x,
       x += 2;
       continue;
     }
-    Cell& cell = storage_[XY{x / 2, y / 4}];
-    cell.type = CellType::kText;
-    cell.content.character = it;
-    style(cell.content);
+    const size_t index = Index(x, y);
+    cells_[index].type = CellType::kText;
+    Pixel& pixel = StyleAt(index);
+    pixel.character = it;
+    style(pixel);
     x += 2;
   }
 }
 
+/// @brief Draw an image, using half block characters.
+/// @param x the x coordinate of the top left pixel of the image.
+/// @param y the y coordinate of the top left pixel of the image.
+/// @param width the width of the image, in pixels.
+/// @param height the height of the image, in pixels.
+/// @param rgb the pixels, 3 bytes each, row after row.
+/// @param stride the number of bytes between the start of two rows.
+///
+/// Every pixel of the image covers one dot. Every cell shows two colors, using
+/// the '▀' character. Each one is the average of the 2x2 pixels of a half of
+/// the cell.
+void Canvas::DrawImage(int x,
+                       int y,
+                       int width,
+                       int height,
+                       const uint8_t* rgb,
+                       int stride) {
+  // The dots covered by both the image and the canvas.
+  const int x_min = std::max(x, 0);
+  const int y_min = std::max(y, 0);
+  const int x_max = std::min(x + width, width_) - 1;
+  const int y_max = std::min(y + height, height_) - 1;
+  if (x_min > x_max || y_min > y_max) {
+    return;
+  }
+  const int cell_x_min = x_min / 2;
+  const int cell_x_max = x_max / 2;
+
+  // The sum of the rows of a half, for the columns of the image in use. The
+  // loops below are simple enough to be vectorized by the compiler.
+  const int column_min = x_min - x;
+  const int column_max = x_max - x;
+  std::vector<uint16_t> sums(size_t(column_max - column_min + 1) * 3);
+  std::vector<Color> top(size_t(cell_x_max - cell_x_min + 1));
+  auto row = [&](int dot_y) {
+    return rgb + ptrdiff_t(dot_y - y) * stride + ptrdiff_t(column_min) * 3;
+  };
+
+  // Compute the color of the half made of the rows of dots |dot_y| and
+  // |dot_y + 1|, for every cell of the row, and call |write(i, color)| for the
+  // i-th one. Return false when the half is outside of the image.
+  auto half = [&](int dot_y, auto write) {
+    const bool first = dot_y >= y_min && dot_y <= y_max;
+    const bool second = dot_y + 1 >= y_min && dot_y + 1 <= y_max;
+    if (!first && !second) {
+      return false;
+    }
+    if (first && second) {
+      const uint8_t* a = row(dot_y);
+      const uint8_t* b = row(dot_y + 1);
+      for (size_t i = 0; i < sums.size(); ++i) {
+        sums[i] = uint16_t(a[i] + b[i]);
+      }
+    } else {
+      const uint8_t* a = row(first ? dot_y : dot_y + 1);
+      for (size_t i = 0; i < sums.size(); ++i) {
+        sums[i] = a[i];
+      }
+    }
+
+    const int rows_shift = first && second ? 1 : 0;
+    for (int cell_x = cell_x_min; cell_x <= cell_x_max; ++cell_x) {
+      const int column = std::max(cell_x * 2, x_min) - x - column_min;
+      const bool pair = cell_x * 2 >= x_min && cell_x * 2 + 1 <= x_max;
+      const int shift = rows_shift + (pair ? 1 : 0);
+      const int rounding = (1 << shift) >> 1;
+      const uint16_t* sum = &sums[size_t(column) * 3];
+      int r = sum[0];
+      int g = sum[1];
+      int b = sum[2];
+      if (pair) {
+        r += sum[3];
+        g += sum[4];
+        b += sum[5];
+      }
+      write(size_t(cell_x - cell_x_min),
+            Color::RGB(uint8_t((r + rounding) >> shift),
+                       uint8_t((g + rounding) >> shift),
+                       uint8_t((b + rounding) >> shift)));
+    }
+    return true;
+  };
+
+  for (int cell_y = y_min / 4; cell_y <= y_max / 4; ++cell_y) {
+    const bool has_top = half(cell_y * 4, [&](size_t i, const Color& color) {
+      top[i] = color;
+    });
+    const size_t row_index = size_t(cell_y) * size_t(cells_x_);
+    auto cell_at = [&](size_t i) -> Cell& {
+      Cell& cell = cells_[row_index + size_t(cell_x_min) + i];
+      cell.type = CellType::kHalfBlock;
+      cell.has_color = true;
+      cell.dirty = true;
+      return cell;
+    };
+    const bool has_bottom =
+        half(cell_y * 4 + 2, [&](size_t i, const Color& color) {
+          Cell& cell = cell_at(i);
+          if (has_top) {
+            cell.mask = kBothHalves;
+            cell.color = top[i];
+            cell.background = color;
+          } else {
+            cell.mask = kBottomHalf;
+            cell.color = color;
+          }
+        });
+    if (has_top && !has_bottom) {
+      for (size_t i = 0; i < top.size(); ++i) {
+        Cell& cell = cell_at(i);
+        cell.mask = kTopHalf;
+        cell.color = top[i];
+      }
+    }
+  }
+}
+
 /// @brief Modify a pixel at a given location.
 /// @param style a function that modifies the pixel.
 void Canvas::Style(int x, int y, const Stylizer& style) {
   if (IsIn(x, y)) {
-    style(storage_[XY{x / 2, y / 4}].content);
+    style(StyleAt(Index(x, y)));
+  }
+}
+
+/// @brief Erase the content of a rectangle.
+/// @param x the x coordinate of the top left dot of the rectangle.
+/// @param y the y coordinate of the top left dot of the rectangle.
+/// @param width the width of the rectangle, in dots.
+/// @param height the height of the rectangle, in dots.
+///
+/// The braille dots, the blocks and the halves of the image cells inside the
+/// rectangle are erased. A character can't be partially erased: the text of
+/// every cell touched by the rectangle is erased. The cells entirely inside
+/// the rectangle are reset, including their style.
+void Canvas::ClearRect(int x, int y, int width, int height) {
+  const int x_min = std::max(x, 0);
+  const int y_min = std::max(y, 0);
+  const int x_max = std::min(x + width, width_) - 1;
+  const int y_max = std::min(y + height, height_) - 1;
+  if (x_min > x_max || y_min > y_max) {
+    return;
+  }
+
+  for (int cell_y = y_min / 4; cell_y <= y_max / 4; ++cell_y) {
+    for (int cell_x = x_min / 2; cell_x <= x_max / 2; ++cell_x) {
+      // The dots of the cell inside the rectangle.
+      const int dot_x_min = std::max(cell_x * 2, x_min);
+      const int dot_x_max = std::min(cell_x * 2 + 1, x_max);
+      const int dot_y_min = std::max(cell_y * 4, y_min);
+      const int dot_y_max = std::min(cell_y * 4 + 3, y_max);
+
+      const size_t index = size_t(cell_y) * size_t(cells_x_) + size_t(cell_x);
+      Cell& cell = cells_[index];
+      if (dot_x_min == cell_x * 2 &&
+          dot_x_max == std::min(cell_x * 2 + 1, width_ - 1) &&
+          dot_y_min == cell_y * 4 &&
+          dot_y_max == std::min(cell_y * 4 + 3, height_ - 1)) {
+        cell = Cell();
+        if (!styles_.empty()) {
+          styles_[index] = Pixel();
+        }
+        continue;
+      }
+
+      // A character can't be partially erased. Its style is kept. Without
+      // styles, no character was ever drawn.
+      if (cell.type == CellType::kText) {
+        if (!styles_.empty()) {
+          cell.dirty = true;
+          styles_[index].character = " ";
+        }
+        continue;
+      }
+      cell.dirty = true;
+      for (int dot_y = dot_y_min; dot_y <= dot_y_max; ++dot_y) {
+        for (int dot_x = dot_x_min; dot_x <= dot_x_max; ++dot_x) {
+          if (cell.type == CellType::kBraille) {
+            cell.mask &= ~g_map_braille[dot_x % 2][dot_y % 4];
+          } else if (cell.type == CellType::kBlock) {
+            cell.mask &= ~(1U << ((dot_x % 2) * 2 + (dot_y / 2) % 2));
+          } else {
+            cell.mask &= dot_y % 4 < 2 ? ~kTopHalf : ~kBottomHalf;
+          }
+        }
+      }
+      if (cell.type == CellType::kHalfBlock && cell.mask == 0) {
+        cell = Cell();
+      }
+    }
+  }
+}
+
+/// @brief Draw the canvas into an area of a screen.
+/// @param screen the screen to draw into.
+/// @param box the area of the screen.
+///
+/// The cells are converted into pixels again only when they were modified
+/// since the previous call. Keep the same Canvas across frames, and modify
+/// only what changes, to pay only for it.
+void Canvas::Blit(Screen& screen, const Box& box) const {
+  if (pixels_.size() != cells_.size()) {
+    pixels_.assign(cells_.size(), Pixel());
+    for (const Cell& cell : cells_) {
+      cell.dirty = true;
+    }
+  }
+
+  const int y_max = std::min(height_ / 4, box.y_max - box.y_min + 1);
+  const int x_max = std::min(width_ / 2, box.x_max - box.x_min + 1);
+  for (int y = 0; y < y_max; ++y) {
+    const PixelSpan span =
+        screen.RowSpan(box.y_min + y, box.x_min, box.x_min + x_max - 1);
+    for (int i = 0; i < span.size; ++i) {
+      const int x = span.x - box.x_min + i;
+      const size_t index = size_t(y) * size_t(cells_x_) + size_t(x);
+      const Cell& cell = cells_[index];
+      if (cell.dirty) {
+        pixels_[index] = GetPixel(x, y);
+        cell.dirty = false;
+      }
+      span.data[i] = pixels_[index];
+    }
   }
 }
 
@@ -828,16 +1245,7 @@ class CanvasNodeBase : public Node {
  public:
   CanvasNodeBase() = default;
 
-  void Render(Screen& screen) override {
-    const Canvas& c = canvas();
-    const int y_max = std::min(c.height() / 4, box_.y_max - box_.y_min + 1);
-    const int x_max = std::min(c.width() / 2, box_.x_max - box_.x_min + 1);
-    for (int y = 0; y < y_max; ++y) {
-      for (int x = 0; x < x_max; ++x) {
-        screen.PixelAt(box_.x_min + x, box_.y_min + y) = c.GetPixel(x, y);
-      }
-    }
-  }
+  void Render(Screen& screen) override { canvas().Blit(screen, box_); }
 
   virtual const Canvas& canvas() = 0;
 };
@@ -1,11 +1,14 @@
 #include <gtest/gtest.h>
-#include <cstdint>  // for uint32_t
-#include <string>   // for allocator, string
+#include <climits>     // for INT_MAX, INT_MIN
+#include <cstdint>     // for uint32_t, uint8_t
+#include <functional>  // for function
+#include <string>      // for allocator, string
+#include <vector>      // for vector
 
-#include "ftxui/dom/canvas.hpp"    // for Canvas
-#include "ftxui/dom/elements.hpp"  // for canvas
-#include "ftxui/dom/node.hpp"      // for Render
-#include "ftxui/screen/color.hpp"  // for Color, Color::Black, Color::Blue, Color::Red, Color::White, Color::Yellow, Color::Cyan, Color::Green
+#include "ftxui/dom/canvas.hpp"       // for Canvas
+#include "ftxui/dom/elements.hpp"     // for canvas
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/color.hpp"     // for Color, Color::Black, Color::Blue, Color::Red, Color::White, Color::Yellow, Color::Cyan, Color::Green
 #include "ftxui/screen/screen.hpp"    // for Screen
 #include "ftxui/screen/terminal.hpp"  // for SetColorSupport, Color, TrueColor
 
@@ -101,6 +104,277 @@ TEST(CanvasTest, GoldText) {
   EXPECT_EQ(Hash(screen.ToString()), 1074960375);
 }
 
+TEST(CanvasTest, GetPixel) {
+  Canvas c(5, 5);
+  for (int y = 0; y < 4; ++y) {
+    c.DrawPointOn(0, y);
+    c.DrawPointOn(1, y);
+  }
+  c.DrawPointOn(4, 4);
+  c.DrawPoint(4, 0, true, Color::Red);
+  c.DrawBlockOn(2, 4);
+  c.DrawText(2, 0, "a", Color::Blue);
+
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⣿");
+  EXPECT_EQ(c.GetPixel(1, 0).character, "a");
+  EXPECT_EQ(c.GetPixel(1, 0).foreground_color, Color(Color::Blue));
+  EXPECT_EQ(c.GetPixel(2, 0).character, "⠁");
+  EXPECT_EQ(c.GetPixel(2, 0).foreground_color, Color(Color::Red));
+  EXPECT_EQ(c.GetPixel(1, 1).character, "▘");
+  EXPECT_EQ(c.GetPixel(2, 1).character, "⠁");
+  EXPECT_EQ(c.GetPixel(0, 1).character, " ");
+  EXPECT_EQ(c.GetPixel(3, 0).character, " ");
+  EXPECT_EQ(c.GetPixel(0, 2).character, " ");
+  EXPECT_EQ(c.GetPixel(-1, 0).character, " ");
+}
+
+TEST(CanvasTest, Bulk) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  std::vector<Canvas::Point> points;
+  std::vector<int> xs;
+  std::vector<int> ys;
+  for (int i = 0; i < 50; ++i) {
+    points.push_back({(i * 7) % 70 - 5, (i * 13) % 50 - 5});
+    xs.push_back(points.back().x);
+    ys.push_back(points.back().y);
+  }
+  auto same = [](const Canvas& a, const Canvas& b) {
+    Screen screen_a(30, 10);
+    Screen screen_b(30, 10);
+    Render(screen_a, canvas(a));
+    Render(screen_b, canvas(b));
+    return screen_a.ToString() == screen_b.ToString();
+  };
+
+  Canvas expected(60, 40);
+  Canvas bulk(60, 40);
+  for (const auto& point : points) {
+    expected.DrawPointOn(point.x, point.y);
+  }
+  bulk.DrawPoints(points);
+  EXPECT_TRUE(same(expected, bulk));
+
+  expected = Canvas(60, 40);
+  bulk = Canvas(60, 40);
+  for (const auto& point : points) {
+    expected.DrawPoint(point.x, point.y, true,
+                       [](Pixel& p) { p.foreground_color = Color::Red; });
+  }
+  bulk.DrawPointScatter(xs.data(), ys.data(), xs.size(), Color::Red);
+  EXPECT_TRUE(same(expected, bulk));
+
+  expected = Canvas(60, 40);
+  bulk = Canvas(60, 40);
+  for (size_t i = 1; i < points.size(); ++i) {
+    expected.DrawPointLine(
+        points[i - 1].x, points[i - 1].y, points[i].x, points[i].y,
+        [](Pixel& p) { p.foreground_color = Color::Blue; });
+  }
+  bulk.DrawPointPolyline(points, Color::Blue);
+  EXPECT_TRUE(same(expected, bulk));
+}
+
+TEST(CanvasTest, Clipping) {
+  // Draw the shapes on a small canvas, and on a large one containing them
+  // entirely. The visible part must be the same.
+  const int margin = 64;
+  auto check = [&](const std::function<void(Canvas&, int)>& draw) {
+    Canvas small(20, 12);
+    Canvas large(20 + 2 * margin, 12 + 2 * margin);
+    draw(small, 0);
+    draw(large, margin);
+    for (int y = 0; y < 3; ++y) {
+      for (int x = 0; x < 10; ++x) {
+        EXPECT_EQ(small.GetPixel(x, y),
+                  large.GetPixel(x + margin / 2, y + margin / 4));
+      }
+    }
+  };
+
+  for (int i = 0; i < 20; ++i) {
+    const int x1 = (i * 37) % 120 - 50;
+    const int y1 = (i * 53) % 110 - 50;
+    const int x2 = (i * 71) % 120 - 50;
+    const int y2 = (i * 29) % 110 - 50;
+    check([&](Canvas& c, int o) {
+      c.DrawPointLine(x1 + o, y1 + o, x2 + o, y2 + o);
+      c.DrawPointLine(x1 + o, y2 + o, x2 + o, y1 + o, Color::Red);
+      c.DrawPointEllipseFilled(x1 + o, y1 + o, 20, 12);
+    });
+    // The blocks are 2 dots high. Use even coordinates, so that they are
+    // rounded the same way in both canvas.
+    check([&](Canvas& c, int o) {
+      c.DrawBlockLine(x1 + o, 2 * (y1 / 2) + o, x2 + o, 2 * (y2 / 2) + o);
+      c.DrawBlockCircleFilled(x2 + o, 2 * (y2 / 2) + o, 16, Color::Blue);
+    });
+  }
+
+  // A line crossing the canvas, with both ends outside.
+  Canvas c(20, 12);
+  c.DrawPointLine(-100, 6, 100, 6);
+  EXPECT_EQ(c.GetPixel(5, 1).character, "⠤");
+}
+
+TEST(CanvasTest, ClipExtremeLine) {
+  // The dots are the ones of the Bresenham algorithm walked from the first
+  // end. The products of the steps and the deltas don't fit in 64 bits.
+  Canvas c(20, 12);
+  c.DrawPointLine(-2000000000, -1000000000, 2000000000, 1000000005);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⡀");
+  EXPECT_EQ(c.GetPixel(0, 1).character, "⠈");
+  EXPECT_EQ(c.GetPixel(3, 1).character, "⢄");
+  EXPECT_EQ(c.GetPixel(8, 2).character, "⡀");
+
+  Canvas steep(20, 12);
+  steep.DrawPointLine(-1000000000, -2000000000, 1000000007, 2000000000);
+  EXPECT_EQ(steep.GetPixel(2, 0).character, "⢣");
+  EXPECT_EQ(steep.GetPixel(3, 1).character, "⢣");
+  EXPECT_EQ(steep.GetPixel(4, 2).character, "⢣");
+
+  Canvas full(20, 12);
+  full.DrawPointLine(INT_MIN, INT_MAX, INT_MAX, INT_MIN + 5);
+  EXPECT_EQ(full.GetPixel(0, 0).character, "⠊");
+  EXPECT_EQ(full.GetPixel(1, 0), Pixel());
+}
+
+TEST(CanvasTest, ClearRect) {
+  Canvas c(20, 12);
+  c.DrawPointLine(0, 1, 19, 1);
+  c.DrawBlockLine(0, 6, 19, 6, Color::Red);
+  c.DrawText(0, 8, "abcdefghij");
+
+  // Partially covered cells: only the dots inside are erased.
+  c.ClearRect(1, 0, 18, 2);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "⠂");
+  EXPECT_EQ(c.GetPixel(4, 0).character, "⠀");
+  EXPECT_EQ(c.GetPixel(9, 0).character, "⠐");
+
+  // Entirely covered cells are reset, style included.
+  c.ClearRect(4, 4, 100, 100);
+  EXPECT_EQ(c.GetPixel(1, 1).character, "▄");
+  EXPECT_EQ(c.GetPixel(1, 1).foreground_color, Color::Red);
+  EXPECT_EQ(c.GetPixel(1, 2).character, "b");
+  EXPECT_EQ(c.GetPixel(2, 1), Pixel());
+  EXPECT_EQ(c.GetPixel(2, 2), Pixel());
+
+  // The text of partially covered cells is erased.
+  c.ClearRect(1, 8, 1, 1);
+  EXPECT_EQ(c.GetPixel(0, 2).character, " ");
+  EXPECT_EQ(c.GetPixel(1, 2).character, "b");
+
+  // The halves of the image cells are erased.
+  const std::vector<uint8_t> image(2 * 4 * 3, 255);
+  c.DrawImage(0, 0, 2, 4, image.data(), 2 * 3);
+  c.ClearRect(0, 0, 1, 1);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "▄");
+
+  // Empty rectangles.
+  c.ClearRect(0, 0, 0, 12);
+  c.ClearRect(-10, -10, 5, 5);
+  EXPECT_EQ(c.GetPixel(0, 0).character, "▄");
+}
+
+TEST(CanvasTest, ClearRectWithoutStyles) {
+  // No cell was given a style. The cells never drawn are empty text cells.
+  Canvas c(20, 12);
+  c.DrawPointOn(10, 10);
+  c.ClearRect(1, 1, 1, 1);
+  c.ClearRect(9, 9, 2, 1);
+  EXPECT_EQ(c.GetPixel(0, 0), Pixel());
+  EXPECT_EQ(c.GetPixel(5, 2).character, "⠄");
+}
+
+TEST(CanvasTest, DrawImage) {
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  // A 5x7 image, whose pixel (x, y) is (10 * x, 10 * y, 100).
+  const int stride = 5 * 3 + 1;
+  std::vector<uint8_t> image(stride * 7);
+  for (int y = 0; y < 7; ++y) {
+    for (int x = 0; x < 5; ++x) {
+      image[y * stride + x * 3 + 0] = uint8_t(10 * x);
+      image[y * stride + x * 3 + 1] = uint8_t(10 * y);
+      image[y * stride + x * 3 + 2] = 100;
+    }
+  }
+
+  Canvas below(20, 12);
+  below.DrawPointLine(0, 0, 19, 11);
+  Canvas c = below;
+  c.DrawImage(2, 4, 5, 7, image.data(), stride);
+
+  // The average of the 2x2 pixels of each half.
+  Pixel pixel = c.GetPixel(1, 1);
+  EXPECT_EQ(pixel.character, "▀");
+  EXPECT_EQ(pixel.foreground_color, Color::RGB(5, 5, 100));
+  EXPECT_EQ(pixel.background_color, Color::RGB(5, 25, 100));
+
+  // On the right, a single column of pixels.
+  pixel = c.GetPixel(3, 1);
+  EXPECT_EQ(pixel.character, "▀");
+  EXPECT_EQ(pixel.foreground_color, Color::RGB(40, 5, 100));
+  EXPECT_EQ(pixel.background_color, Color::RGB(40, 25, 100));
+
+  // At the bottom, a single row of pixels in the bottom half.
+  pixel = c.GetPixel(2, 2);
+  EXPECT_EQ(pixel.character, "▀");
+  EXPECT_EQ(pixel.foreground_color, Color::RGB(25, 45, 100));
+  EXPECT_EQ(pixel.background_color, Color::RGB(25, 60, 100));
+
+  // Around the image, the canvas is left untouched.
+  for (int y = 0; y < 3; ++y) {
+    for (int x = 0; x < 10; ++x) {
+      if (x < 1 || x > 3 || y < 1) {
+        EXPECT_EQ(c.GetPixel(x, y), below.GetPixel(x, y));
+      }
+    }
+  }
+
+  // Partially outside of the canvas, with only the bottom half of the first
+  // row of cells.
+  c.DrawImage(-3, 2, 5, 7, image.data(), stride);
+  pixel = c.GetPixel(0, 0);
+  EXPECT_EQ(pixel.character, "▄");
+  EXPECT_EQ(pixel.foreground_color, Color::RGB(35, 5, 100));
+  EXPECT_EQ(pixel.background_color, Color());
+
+  // Only the top half of the last row of cells.
+  c.DrawImage(12, 4, 5, 6, image.data(), stride);
+  pixel = c.GetPixel(6, 2);
+  EXPECT_EQ(pixel.character, "▀");
+  EXPECT_EQ(pixel.foreground_color, Color::RGB(5, 45, 100));
+  EXPECT_EQ(pixel.background_color, Color());
+
+  // Styling a cell keeps its colors.
+  c.Style(2, 4, [](Pixel& p) { p.bold = true; });
+  pixel = c.GetPixel(1, 1);
+  EXPECT_EQ(pixel.character, "▀");
+  EXPECT_EQ(pixel.foreground_color, Color::RGB(5, 5, 100));
+  EXPECT_EQ(pixel.background_color, Color::RGB(5, 25, 100));
+  EXPECT_TRUE(pixel.bold);
+}
+
+TEST(CanvasTest, Persistent) {
+  // A canvas modified between frames is drawn the same way as a new one.
+  Canvas persistent(40, 20);
+  for (int frame = 0; frame < 5; ++frame) {
+    auto draw = [&](Canvas& c) {
+      c.DrawText(0, 0, "frame " + std::to_string(frame));
+      c.DrawPointLine(0, 19, frame * 8, 4, Color::Blue);
+    };
+    Canvas expected(40, 20);
+    draw(expected);
+
+    persistent.ClearRect(0, 4, 40, 16);
+    draw(persistent);
+
+    Screen screen_expected(20, 5);
+    Screen screen(20, 5);
+    Render(screen_expected, canvas(std::move(expected)));
+    Render(screen, canvas(&persistent));
+    EXPECT_EQ(screen.ToString(), screen_expected.ToString());
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -1,6 +1,7 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
+#include "ftxui/dom/display_list.hpp"    // for DisplayList
 #include "ftxui/dom/elements.hpp"        // for Element, clear_under
 #include "ftxui/dom/node.hpp"            // for Node
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
@@ -16,13 +17,20 @@ class ClearUnder : public NodeDecorator {
   using NodeDecorator::NodeDecorator;
 
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = Pixel();
-      }
-    }
+    screen.FillRect(box_, Pixel());
     Node::Render(screen);
   }
+
+  Box OpaqueBox() override { return box_; }
+
+  void Compile(DisplayList& list) override {
+    list.FillRect(box_, Pixel());
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+  }
+
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
 };
 
 /// @brief Before drawing |child|, clear the pixels below. This is useful in
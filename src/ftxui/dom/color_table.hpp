@@ -0,0 +1,44 @@
+#ifndef FTXUI_DOM_COLOR_TABLE_HPP
+#define FTXUI_DOM_COLOR_TABLE_HPP
+
+#include <cstddef>  // for size_t
+#include <vector>   // for vector
+
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/terminal.hpp"  // for ColorSupport, Color
+
+namespace ftxui {
+
+// The colors of a gradient, sampled at evenly spaced positions, so that
+// drawing reads them instead of interpolating colors for every pixel. Colors
+// depend on the color support of the terminal, so they are sampled again when
+// it changes.
+class ColorTable {
+ public:
+  // Return the colors |sample(t)|, for |steps| + 1 values of t from 0 to 1.
+  template <typename Sample>
+  const std::vector<Color>& Get(int steps, Sample sample) {
+    const Terminal::Color support = Terminal::ColorSupport();
+    if (colors_.size() == size_t(steps + 1) && support_ == support) {
+      return colors_;
+    }
+    colors_.resize(size_t(steps + 1));
+    for (int i = 0; i <= steps; ++i) {
+      colors_[size_t(i)] = sample(float(i) / float(steps));
+    }
+    support_ = support;
+    return colors_;
+  }
+
+ private:
+  std::vector<Color> colors_;
+  Terminal::Color support_ = Terminal::Color::Palette1;
+};
+
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_COLOR_TABLE_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
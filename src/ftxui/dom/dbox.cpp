@@ -1,15 +1,50 @@
 #include <algorithm>  // for max
+#include <cstddef>    // for size_t
 #include <memory>     // for __shared_ptr_access, shared_ptr, make_shared
 #include <utility>    // for move
 #include <vector>     // for vector
 
-#include "ftxui/dom/elements.hpp"     // for Element, Elements, dbox
-#include "ftxui/dom/node.hpp"         // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Element, Elements, dbox
+#include "ftxui/dom/node.hpp"          // for Node, Elements
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/screen.hpp"     // for Screen
 
 namespace ftxui {
 
+namespace {
+
+// Return the part of |box| not covered by |hidden|. When it isn't a rectangle,
+// |box| is returned unchanged.
+Box Uncovered(Box box, const Box& hidden) {
+  if (Box::Intersection(box, hidden).IsEmpty()) {
+    return box;
+  }
+  const bool cover_x = hidden.x_min <= box.x_min && hidden.x_max >= box.x_max;
+  const bool cover_y = hidden.y_min <= box.y_min && hidden.y_max >= box.y_max;
+  if (cover_x && cover_y) {
+    return Box{0, -1, 0, -1};
+  }
+  if (cover_x) {
+    if (hidden.y_min <= box.y_min) {
+      box.y_min = hidden.y_max + 1;
+    } else if (hidden.y_max >= box.y_max) {
+      box.y_max = hidden.y_min - 1;
+    }
+  }
+  if (cover_y) {
+    if (hidden.x_min <= box.x_min) {
+      box.x_min = hidden.x_max + 1;
+    } else if (hidden.x_max >= box.x_max) {
+      box.x_max = hidden.x_min - 1;
+    }
+  }
+  return box;
+}
+
+}  // namespace
+
 class DBox : public Node {
  public:
   explicit DBox(Elements children) : Node(std::move(children)) {}
@@ -43,6 +78,42 @@ class DBox : public Node {
       child->SetBox(box);
     }
   }
+
+  // Layers are drawn bottom to top. The layers entirely hidden below the
+  // opaque areas of upper layers are skipped.
+  void Render(Screen& screen) override {
+    std::vector<Box> visible(children_.size());
+    std::vector<Box> opaque;
+    for (size_t i = children_.size(); i-- > 0;) {
+      Box& box = visible[i];
+      box = Box::Intersection(children_[i]->box(), screen.stencil);
+      for (const Box& hidden : opaque) {
+        box = Uncovered(box, hidden);
+      }
+      if (i != 0 && !box.IsEmpty()) {
+        const Box layer_opaque = children_[i]->OpaqueBox();
+        if (!layer_opaque.IsEmpty()) {
+          opaque.push_back(layer_opaque);
+        }
+      }
+    }
+
+    // A partially hidden layer is drawn whole: some elements, like frame,
+    // position their content from the stencil, so it must not be narrowed.
+    for (size_t i = 0; i < children_.size(); ++i) {
+      if (!visible[i].IsEmpty()) {
+        children_[i]->Render(screen);
+      }
+    }
+  }
+
+  void Compile(DisplayList& list) override {
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+  }
+
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
 };
 
 /// @brief Stack several element on top of each other.
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
-#include <string>  // for allocator
+#include <memory>   // for make_shared
+#include <string>   // for allocator, to_string
+#include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"  // for filler, operator|, text, border, dbox, hbox, vbox, Element
 #include "ftxui/dom/node.hpp"       // for Render
@@ -8,6 +10,32 @@
 // NOLINTBEGIN
 namespace ftxui {
 
+namespace {
+
+// Fill its box, counting how many cells are drawn.
+class CountedFill : public Node {
+ public:
+  explicit CountedFill(int* count) : count_(count) {}
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+  void Render(Screen& screen) override {
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
+        screen.at(x, y) = "x";
+        ++*count_;
+      }
+    }
+  }
+
+ private:
+  int* count_;
+};
+
+}  // namespace
+
 TEST(DBoxTest, Basic) {
   auto root = dbox({
       hbox({
@@ -29,6 +57,75 @@ TEST(DBoxTest, Basic) {
             "╰────╯  ");
 }
 
+TEST(DBoxTest, OccludedLayerIsSkipped) {
+  int count = 0;
+  auto root = dbox({
+      std::make_shared<CountedFill>(&count),
+      text("top") | clear_under,
+  });
+  Screen screen(4, 2);
+  Render(screen, root);
+  EXPECT_EQ(count, 0);
+  EXPECT_EQ(screen.ToString(),
+            "top \r\n"
+            "    ");
+}
+
+TEST(DBoxTest, PartiallyOccludedLayerIsDrawn) {
+  int count = 0;
+  auto root = dbox({
+      std::make_shared<CountedFill>(&count),
+      vbox({
+          text("top") | clear_under | xflex,
+          filler(),
+      }),
+  });
+  Screen screen(4, 3);
+  Render(screen, root);
+  EXPECT_EQ(count, 12);
+  EXPECT_EQ(screen.ToString(),
+            "top \r\n"
+            "xxxx\r\n"
+            "xxxx");
+}
+
+// The stencil seen by a partially hidden layer is unchanged, since frame and
+// vscroll_indicator position their content from it.
+TEST(DBoxTest, PartiallyOccludedFrame) {
+  Elements lines;
+  for (int i = 0; i < 40; ++i) {
+    lines.push_back(text("line " + std::to_string(i)));
+  }
+  auto root = dbox({
+      vbox(std::move(lines)) | vscroll_indicator | frame,
+      hbox({
+          filler(),
+          text("TOP") | size(WIDTH, EQUAL, 5) | clear_under,
+      }),
+  });
+  Screen screen(20, 5);
+  Render(screen, root);
+  EXPECT_EQ(screen.ToString(),
+            "line 0         TOP  \r\n"
+            "line 1              \r\n"
+            "line 2              \r\n"
+            "line 3              \r\n"
+            "line 4              ");
+}
+
+TEST(DBoxTest, WindowsOcclusion) {
+  int count = 0;
+  auto layer = [&] {
+    return window(text("title"), std::make_shared<CountedFill>(&count)) |
+           clear_under;
+  };
+  auto root = dbox({layer(), layer(), layer()});
+  Screen screen(10, 5);
+  Render(screen, root);
+  // Only the top window content is drawn.
+  EXPECT_EQ(count, 8 * 3);
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -0,0 +1,156 @@
+#include <utility>  // for move
+#include <vector>   // for vector
+
+#include "ftxui/dom/display_list.hpp"
+#include "ftxui/dom/node.hpp"       // for Node
+#include "ftxui/dom/style.hpp"      // for Style
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Pixel, PixelSpan, Screen
+#include "ftxui/screen/string.hpp"  // for Utf8ToGlyphs
+
+namespace ftxui {
+
+/// @brief Record filling |box| with |pixel|.
+void DisplayList::FillRect(Box box, const Pixel& pixel) {
+  ops_.push_back({Op::Type::FillRect, box, pixels_.size(), 1});
+  pixels_.push_back(pixel);
+}
+
+/// @brief Record replacing the character of every pixel of |box| by |glyph|.
+void DisplayList::FillGlyph(Box box, const std::string& glyph) {
+  ops_.push_back({Op::Type::FillGlyph, box, glyphs_.size(), 1});
+  glyphs_.push_back(glyph);
+}
+
+/// @brief Record drawing |text| on the row |y|, starting at |x| and stopping
+/// after |x_max|.
+void DisplayList::DrawGlyphs(int x, int y, int x_max, const std::string& text) {
+  const size_t index = glyphs_.size();
+  for (auto& glyph : Utf8ToGlyphs(text)) {
+    if (glyph == "\n") {
+      continue;
+    }
+    if (x + int(glyphs_.size() - index) > x_max) {
+      break;
+    }
+    glyphs_.push_back(std::move(glyph));
+  }
+  ops_.push_back({Op::Type::DrawGlyphs, Box{x, x_max, y, y}, index,
+                  glyphs_.size() - index});
+}
+
+/// @brief Record applying |style| to every pixel of |box|. It is merged with
+/// the previous operation when it styles the same box.
+void DisplayList::ApplyStyle(Box box, const Style& style) {
+  if (!ops_.empty() && ops_.back().type == Op::Type::ApplyStyle &&
+      ops_.back().box == box && styles_.back().Merge(style)) {
+    return;
+  }
+  ops_.push_back({Op::Type::ApplyStyle, box, styles_.size(), 1});
+  styles_.push_back(style);
+}
+
+/// @brief Record moving the cursor.
+void DisplayList::SetCursor(Screen::Cursor cursor) {
+  ops_.push_back({Op::Type::SetCursor, Box{}, cursors_.size(), 1});
+  cursors_.push_back(cursor);
+}
+
+/// @brief Record restricting the drawing of the next operations to |box|,
+/// until the matching PopStencil().
+void DisplayList::PushStencil(Box box) {
+  ops_.push_back({Op::Type::PushStencil, box, 0, 0});
+}
+
+void DisplayList::PopStencil() {
+  ops_.push_back({Op::Type::PopStencil, Box{}, 0, 0});
+}
+
+/// @brief Record drawing |node| using Node::Render. This is used for elements
+/// not providing a specialized Compile().
+void DisplayList::Draw(Node* node) {
+  ops_.push_back({Op::Type::Draw, Box{}, nodes_.size(), 1});
+  nodes_.push_back(node);
+}
+
+void DisplayList::Clear() {
+  ops_.clear();
+  pixels_.clear();
+  glyphs_.clear();
+  styles_.clear();
+  cursors_.clear();
+  nodes_.clear();
+  root_.reset();
+}
+
+/// @brief Execute every recorded operation on |screen|.
+void DisplayList::Execute(Screen& screen) const {
+  std::vector<Box> stencils;
+  for (const Op& op : ops_) {
+    switch (op.type) {
+      case Op::Type::FillRect: {
+        screen.FillRect(op.box, pixels_[op.index]);
+        break;
+      }
+
+      case Op::Type::FillGlyph: {
+        const std::string& glyph = glyphs_[op.index];
+        screen.ForEachPixel(op.box,
+                            [&](Pixel& pixel) { pixel.character = glyph; });
+        break;
+      }
+
+      case Op::Type::DrawGlyphs: {
+        const PixelSpan span = screen.RowSpan(
+            op.box.y_min, op.box.x_min, op.box.x_min + int(op.size) - 1);
+        if (span.size == 0) {
+          break;
+        }
+        const std::string* glyph =
+            glyphs_.data() + op.index + size_t(span.x - op.box.x_min);
+        for (Pixel& pixel : span) {
+          pixel.character = *glyph++;
+        }
+        break;
+      }
+
+      case Op::Type::ApplyStyle: {
+        const Style& style = styles_[op.index];
+        screen.ForEachPixel(op.box, [&](Pixel& pixel) { style.Apply(pixel); });
+        break;
+      }
+
+      case Op::Type::SetCursor:
+        screen.SetCursor(cursors_[op.index]);
+        break;
+
+      case Op::Type::PushStencil:
+        stencils.push_back(screen.stencil);
+        screen.stencil = Box::Intersection(op.box, screen.stencil);
+        break;
+
+      case Op::Type::PopStencil:
+        screen.stencil = stencils.back();
+        stencils.pop_back();
+        break;
+
+      case Op::Type::Draw:
+        nodes_[op.index]->Render(screen);
+        break;
+    }
+  }
+}
+
+/// @brief Display a compiled element on a ftxui::Screen.
+/// @ingroup dom
+void Render(Screen& screen, const DisplayList& list) {
+  screen.stencil = Box{0, screen.dimx() - 1, 0, screen.dimy() - 1};
+  list.Execute(screen);
+  screen.ApplyShader();
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <string>         // for allocator, string
+
+#include "ftxui/dom/display_list.hpp"  // for DisplayList, Compile, Render
+#include "ftxui/dom/elements.hpp"      // for operator|, text, border, vbox, hbox, bold, dim, inverted, color, frame, focus, separator, Element
+#include "ftxui/dom/node.hpp"          // for Render
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/color.hpp"      // for Color, Color::Red, Color::Blue
+#include "ftxui/screen/screen.hpp"     // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Element Document() {
+  Elements lines;
+  for (int i = 0; i < 20; ++i) {
+    lines.push_back(hbox({
+        text("line " + std::to_string(i)) | bold,
+        separator(),
+        text("value") | dim | inverted | color(Color::Red),
+        separatorCharacter("#") | bgcolor(Color::Blue),
+    }));
+  }
+  lines[5] = lines[5] | focus;
+  return vbox({
+             text("Title") | underlined | center,
+             separatorDouble(),
+             vbox(std::move(lines)) | vscroll_indicator | frame | flex,
+             gauge(0.5) | clear_under,
+         }) |
+         borderRounded;
+}
+
+bool SamePixels(const Screen& a, const Screen& b) {
+  for (int y = 0; y < a.dimy(); ++y) {
+    for (int x = 0; x < a.dimx(); ++x) {
+      if (!(a.PixelAt(x, y) == b.PixelAt(x, y))) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(DisplayListTest, MatchesRender) {
+  Screen expected(30, 10);
+  Render(expected, Document());
+
+  Screen screen(30, 10);
+  Render(screen, Compile(screen, Document()));
+
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+  EXPECT_TRUE(SamePixels(screen, expected));
+  EXPECT_EQ(screen.cursor().x, expected.cursor().x);
+  EXPECT_EQ(screen.cursor().y, expected.cursor().y);
+}
+
+TEST(DisplayListTest, Replay) {
+  Screen expected(30, 10);
+  Render(expected, Document());
+
+  Screen screen(30, 10);
+  const DisplayList list = Compile(screen, Document());
+  for (int i = 0; i < 3; ++i) {
+    screen.Clear();
+    Render(screen, list);
+    EXPECT_TRUE(SamePixels(screen, expected));
+  }
+}
+
+TEST(DisplayListTest, MergeStyles) {
+  Screen screen(5, 1);
+  auto list = Compile(screen, text("text") | dim | underlined | blink);
+  // One glyph run, followed by a single style operation.
+  EXPECT_EQ(list.size(), 2u);
+
+  Render(screen, list);
+  EXPECT_TRUE(screen.PixelAt(0, 0).dim);
+  EXPECT_TRUE(screen.PixelAt(0, 0).underlined);
+  EXPECT_TRUE(screen.PixelAt(0, 0).blink);
+}
+
+TEST(DisplayListTest, InvertedTwice) {
+  Screen screen(5, 1);
+  auto list = Compile(screen, text("text") | inverted | inverted);
+  // The two decorators cancel each other.
+  EXPECT_EQ(list.size(), 1u);
+
+  Render(screen, list);
+  EXPECT_FALSE(screen.PixelAt(0, 0).inverted);
+}
+
+TEST(DisplayListTest, ClippedGlyphs) {
+  Screen screen(10, 1);
+  const DisplayList list = Compile(screen, hbox({text("left"), text("right")}));
+
+  // The second glyph run is entirely outside of the stencil.
+  screen.stencil = Box{0, 3, 0, 0};
+  list.Execute(screen);
+  EXPECT_EQ(screen.ToString(), "left      ");
+}
+
+TEST(DisplayListTest, Fallback) {
+  // Elements without a specialized Compile() are drawn using Render().
+  Screen expected(10, 3);
+  Render(expected, gauge(0.5) | border);
+
+  Screen screen(10, 3);
+  Render(screen, Compile(screen, gauge(0.5) | border));
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,78 @@
+#include "ftxui/dom/effects.hpp"
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+
+namespace ftxui {
+
+namespace {
+
+// The innermost recorder of this thread. The threads drawing the content of
+// parallel() elements don't have one.
+thread_local EffectsRecorder* g_recorder = nullptr;  // NOLINT
+
+bool operator!=(const Screen::Cursor& a, const Screen::Cursor& b) {
+  return a.x != b.x || a.y != b.y || a.shape != b.shape;
+}
+
+}  // namespace
+
+void Effects::Replay(Screen& screen, int dx, int dy) const {
+  for (const Reflected& it : reflected) {
+    if (it.box.IsEmpty()) {
+      *it.target = it.box;
+    } else {
+      const Box moved = {
+          it.box.x_min + dx,
+          it.box.x_max + dx,
+          it.box.y_min + dy,
+          it.box.y_max + dy,
+      };
+      *it.target = Box::Intersection(moved, screen.stencil);
+    }
+    EffectsRecorder::OnReflect(*it.target);
+  }
+  if (moves_cursor) {
+    Screen::Cursor moved = cursor;
+    moved.x += dx;
+    moved.y += dy;
+    screen.SetCursor(moved);
+  }
+}
+
+EffectsRecorder::EffectsRecorder(const Screen& screen, Effects* effects)
+    : screen_(screen),
+      effects_(effects),
+      cursor_(screen.cursor()),
+      parent_(g_recorder) {
+  *effects_ = Effects();
+  g_recorder = this;
+}
+
+EffectsRecorder::~EffectsRecorder() {
+  g_recorder = parent_;
+  effects_->cursor = screen_.cursor();
+  effects_->moves_cursor = effects_->cursor != cursor_;
+}
+
+// static
+void EffectsRecorder::OnReflect(Box& box) {
+  for (EffectsRecorder* recorder = g_recorder; recorder;
+       recorder = recorder->parent_) {
+    recorder->effects_->reflected.push_back({&box, box});
+  }
+}
+
+// static
+void EffectsRecorder::OnUntracked() {
+  for (EffectsRecorder* recorder = g_recorder; recorder;
+       recorder = recorder->parent_) {
+    recorder->effects_->complete = false;
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
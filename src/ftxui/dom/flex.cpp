@@ -2,10 +2,11 @@
 #include <utility>  // for move
 #include <vector>   // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
-#include "ftxui/dom/node.hpp"      // for Elements, Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Element, unpack, filler, flex, flex_grow, flex_shrink, notflex, xflex, xflex_grow, xflex_shrink, yflex, yflex_grow, yflex_shrink
+#include "ftxui/dom/node.hpp"          // for Elements, Node
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/box.hpp"        // for Box
 
 namespace ftxui {
 
@@ -80,12 +81,22 @@ class Flex : public Node {
   }
 
   void SetBox(Box box) override {
+    Node::SetBox(box);
     if (children_.empty()) {
       return;
     }
     children_[0]->SetBox(box);
   }
 
+  void Compile(DisplayList& list) override {
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+  }
+
+  // The flex function only modifies the requirement.
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
+
   FlexFunction f_;
 };
 
@@ -4,9 +4,11 @@
 #include <utility>  // for move, swap
 #include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Elements, flexbox, hflow, vflow
+#include "ftxui/dom/display_list.hpp"    // for DisplayList
+#include "ftxui/dom/elements.hpp"        // for Element, Elements, flexbox, hflow, vflow
 #include "ftxui/dom/flexbox_config.hpp"  // for FlexboxConfig, FlexboxConfig::Direction, FlexboxConfig::Direction::Column, FlexboxConfig::AlignContent, FlexboxConfig::Direction::ColumnInversed, FlexboxConfig::Direction::Row, FlexboxConfig::JustifyContent, FlexboxConfig::Wrap, FlexboxConfig::AlignContent::FlexStart, FlexboxConfig::Direction::RowInversed, FlexboxConfig::JustifyContent::FlexStart, FlexboxConfig::Wrap::Wrap
 #include "ftxui/dom/flexbox_helper.hpp"  // for Block, Global, Compute
+#include "ftxui/dom/hash.hpp"            // for HashValue
 #include "ftxui/dom/node.hpp"            // for Node, Elements, Node::Status
 #include "ftxui/dom/requirement.hpp"     // for Requirement
 #include "ftxui/screen/box.hpp"          // for Box
@@ -187,6 +189,23 @@ class Flexbox : public Node {
     status->need_iteration |= need_iteration_;
   }
 
+  void Compile(DisplayList& list) override {
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, config_.direction);
+    HashValue(hash, config_.wrap);
+    HashValue(hash, config_.justify_content);
+    HashValue(hash, config_.align_items);
+    HashValue(hash, config_.align_content);
+    HashValue(hash, config_.gap_x);
+    HashValue(hash, config_.gap_y);
+    return HashChildren(hash);
+  }
+
   int asked_ = 6000;  // NOLINT
   bool need_iteration_ = true;
   const FlexboxConfig config_;
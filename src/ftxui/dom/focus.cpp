@@ -1,10 +1,11 @@
 #include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Decorator, Element, focusPosition, focusPositionRelative
+#include "ftxui/dom/display_list.hpp"    // for DisplayList
+#include "ftxui/dom/elements.hpp"        // for Decorator, Element, focusPosition, focusPositionRelative
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::NORMAL, Requirement::Selection
-#include "ftxui/screen/box.hpp"  // for Box
+#include "ftxui/dom/requirement.hpp"     // for Requirement, Requirement::NORMAL, Requirement::Selection
+#include "ftxui/screen/box.hpp"          // for Box
 
 namespace ftxui {
 
@@ -42,6 +43,15 @@ Decorator focusPositionRelative(float x, float y) {
       box.y_max = int(float(requirement_.min_y) * y_);
     }
 
+    void Compile(DisplayList& list) override {
+      for (auto& child : children_) {
+        child->Compile(list);
+      }
+    }
+
+    // The position is part of the requirement.
+    bool Hash(size_t* hash) override { return HashChildren(hash); }
+
    private:
     const float x_;
     const float y_;
@@ -81,6 +91,15 @@ Decorator focusPosition(int x, int y) {
       box.y_max = y_;
     }
 
+    void Compile(DisplayList& list) override {
+      for (auto& child : children_) {
+        child->Compile(list);
+      }
+    }
+
+    // The position is part of the requirement.
+    bool Hash(size_t* hash) override { return HashChildren(hash); }
+
    private:
     const int x_;
     const int y_;
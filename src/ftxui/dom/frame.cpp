@@ -3,12 +3,14 @@
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Element, unpack, Elements, focus, frame, select, xframe, yframe
-#include "ftxui/dom/node.hpp"  // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement, Requirement::FOCUSED, Requirement::SELECTED
-#include "ftxui/screen/box.hpp"      // for Box
-#include "ftxui/screen/screen.hpp"   // for Screen, Screen::Cursor
-#include "ftxui/util/autoreset.hpp"  // for AutoReset
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Element, unpack, Elements, focus, frame, select, xframe, yframe
+#include "ftxui/dom/hash.hpp"          // for HashValue
+#include "ftxui/dom/node.hpp"          // for Node, Elements
+#include "ftxui/dom/requirement.hpp"   // for Requirement, Requirement::FOCUSED, Requirement::SELECTED
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/screen.hpp"     // for Screen, Screen::Cursor
+#include "ftxui/util/autoreset.hpp"    // for AutoReset
 
 namespace ftxui {
 
@@ -33,6 +35,14 @@ class Select : public Node {
     Node::SetBox(box);
     children_[0]->SetBox(box);
   }
+
+  void Compile(DisplayList& list) override {
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+  }
+
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
 };
 
 Element select(Element child) {
@@ -76,6 +86,17 @@ class Focus : public Select {
         box_.y_min,
         Screen::Cursor::Shape::Hidden,
     });
+#endif
+  }
+
+  void Compile(DisplayList& list) override {
+    Select::Compile(list);
+#if !defined(FTXUI_MICROSOFT_TERMINAL_FALLBACK)
+    list.SetCursor(Screen::Cursor{
+        box_.x_min,
+        box_.y_min,
+        Screen::Cursor::Shape::Hidden,
+    });
 #endif
   }
 };
@@ -130,6 +151,22 @@ class Frame : public Node {
     children_[0]->Render(screen);
   }
 
+  Box OpaqueBox() override {
+    return Box::Intersection(Node::OpaqueBox(), box_);
+  }
+
+  void Compile(DisplayList& list) override {
+    list.PushStencil(box_);
+    children_[0]->Compile(list);
+    list.PopStencil();
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, x_frame_);
+    HashValue(hash, y_frame_);
+    return HashChildren(hash);
+  }
+
  private:
   bool x_frame_;
   bool y_frame_;
@@ -165,6 +202,18 @@ class FocusCursor : public Focus {
         shape_,
     });
   }
+  void Compile(DisplayList& list) override {
+    Select::Compile(list);  // NOLINT
+    list.SetCursor(Screen::Cursor{
+        box_.x_min,
+        box_.y_min,
+        shape_,
+    });
+  }
+  bool Hash(size_t* hash) override {
+    HashValue(hash, shape_);
+    return Focus::Hash(hash);
+  }
   Screen::Cursor::Shape shape_;
 };
 
@@ -2,11 +2,13 @@
 #include <memory>                   // for allocator, make_shared
 #include <string>                   // for string
 
-#include "ftxui/dom/elements.hpp"  // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/dom/elements.hpp"      // for Element, gauge, gaugeDirection, gaugeDown, gaugeLeft, gaugeRight, gaugeUp
+#include "ftxui/dom/gauge_helper.hpp"  // for RenderHorizontal
+#include "ftxui/dom/hash.hpp"          // for HashValue
+#include "ftxui/dom/node.hpp"          // for Node
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/screen.hpp"     // for Screen, Pixel, PixelSpan
 
 namespace ftxui {
 
@@ -39,6 +41,32 @@ static const std::string charset_vertical[10] = {
     " ",
 };
 
+namespace gauge_helper {
+
+void RenderHorizontal(Screen& screen,
+                      int x_min,
+                      int x_max,
+                      int y,
+                      float progress) {
+  const auto limit = float(x_min) + progress * float(x_max - x_min + 1);
+  const int limit_int = static_cast<int>(limit);
+  const PixelSpan span = screen.RowSpan(y, x_min, x_max);
+  for (int i = 0; i < span.size; ++i) {
+    const int x = span.x + i;
+    if (x < limit_int) {
+      span.data[i].character = charset_horizontal[9];  // NOLINT
+    } else if (x == limit_int) {
+      // NOLINTNEXTLINE
+      span.data[i].character =
+          charset_horizontal[int(9 * (limit - float(limit_int)))];
+    } else {
+      span.data[i].character = charset_horizontal[0];
+    }
+  }
+}
+
+}  // namespace gauge_helper
+
 class Gauge : public Node {
  public:
   Gauge(float progress, Direction direction)
@@ -92,37 +120,25 @@ class Gauge : public Node {
 
   void RenderHorizontal(Screen& screen, bool invert) {
     const int y = box_.y_min;
-    if (y > box_.y_max) {
+    if (y > box_.y_max || y < screen.stencil.y_min ||
+        y > screen.stencil.y_max) {
       return;
     }
 
     // Draw the progress bar horizontally.
-    {
-      const float progress = invert ? 1.F - progress_ : progress_;
-      const auto limit =
-          float(box_.x_min) + progress * float(box_.x_max - box_.x_min + 1);
-      const int limit_int = static_cast<int>(limit);
-      int x = box_.x_min;
-      while (x < limit_int) {
-        screen.at(x++, y) = charset_horizontal[9];  // NOLINT
-      }
-      // NOLINTNEXTLINE
-      screen.at(x++, y) = charset_horizontal[int(9 * (limit - limit_int))];
-      while (x <= box_.x_max) {
-        screen.at(x++, y) = charset_horizontal[0];
-      }
-    }
+    gauge_helper::RenderHorizontal(screen, box_.x_min, box_.x_max, y,
+                                   invert ? 1.F - progress_ : progress_);
 
     if (invert) {
-      for (int x = box_.x_min; x <= box_.x_max; x++) {
-        screen.PixelAt(x, y).inverted ^= true;
-      }
+      screen.ForEachPixel(Box{box_.x_min, box_.x_max, y, y},
+                          [](Pixel& pixel) { pixel.inverted ^= true; });
     }
   }
 
   void RenderVertical(Screen& screen, bool invert) {
     const int x = box_.x_min;
-    if (x > box_.x_max) {
+    if (x > box_.x_max || x < screen.stencil.x_min ||
+        x > screen.stencil.x_max) {
       return;
     }
 
@@ -144,12 +160,17 @@ class Gauge : public Node {
     }
 
     if (invert) {
-      for (int y = box_.y_min; y <= box_.y_max; y++) {
-        screen.PixelAt(x, y).inverted ^= true;
-      }
+      screen.ForEachPixel(Box{x, x, box_.y_min, box_.y_max},
+                          [](Pixel& pixel) { pixel.inverted ^= true; });
     }
   }
 
+  bool Hash(size_t* hash) override {
+    HashValue(hash, progress_);
+    HashValue(hash, direction_);
+    return HashChildren(hash);
+  }
+
  private:
   float progress_;
   Direction direction_;
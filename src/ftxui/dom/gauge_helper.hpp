@@ -0,0 +1,24 @@
+#ifndef FTXUI_DOM_GAUGE_HELPER_HPP
+#define FTXUI_DOM_GAUGE_HELPER_HPP
+
+namespace ftxui {
+class Screen;
+
+namespace gauge_helper {
+
+// Draw the characters of a gauge filled from left to right with |progress|,
+// in [0, 1], on the row |y| from |x_min| to |x_max|. Clipped to the stencil.
+void RenderHorizontal(Screen& screen,
+                      int x_min,
+                      int x_max,
+                      int y,
+                      float progress);
+
+}  // namespace gauge_helper
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_GAUGE_HELPER_HPP */
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,35 +1,20 @@
-#include <algorithm>  // for max, min
+#include <algorithm>  // for max, min, upper_bound
 #include <cstddef>    // for size_t
 #include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
-#include "ftxui/dom/elements.hpp"     // for Elements, filler, Element, gridbox
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/box_helper.hpp"    // for Element, Compute
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Elements, Element, gridbox
+#include "ftxui/dom/hash.hpp"          // for HashValue
+#include "ftxui/dom/node.hpp"          // for Node
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/box.hpp"        // for Box
 
 namespace ftxui {
 class Screen;
 
-namespace {
-
-// Accumulate the values of a list U[n] into v[n]. So that:
-// V[0] = 0;
-// V[n+1] = v[n] + U[n]
-// return the sum of U[n].
-int Integrate(std::vector<int>& elements) {
-  int accu = 0;
-  for (auto& i : elements) {
-    const int old_accu = accu;
-    accu += i;
-    i = old_accu;
-  }
-  return accu;
-}
-}  // namespace
-
 class GridBox : public Node {
  public:
   explicit GridBox(std::vector<Elements> lines) : lines_(std::move(lines)) {
@@ -37,13 +22,6 @@ class GridBox : public Node {
     for (const auto& line : lines_) {
       x_size = std::max(x_size, int(line.size()));
     }
-
-    // Fill in empty cells, in case the user did not used the API correctly:
-    for (auto& line : lines_) {
-      while (line.size() < size_t(x_size)) {
-        line.push_back(filler());
-      }
-    }
   }
 
   void ComputeRequirement() override {
@@ -53,102 +31,153 @@ class GridBox : public Node {
     requirement_.flex_grow_y = 0;
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
+    requirement_.selection = Requirement::NORMAL;
 
-    for (auto& line : lines_) {
-      for (auto& cell : line) {
-        cell->ComputeRequirement();
+    // Compute the size and flexibility of each column/row, in a single pass
+    // over the cells. They are kept for SetBox().
+    box_helper::Element init;
+    init.min_size = 0;
+    init.flex_grow = 1024;    // NOLINT
+    init.flex_shrink = 1024;  // NOLINT
+    columns_.assign(x_size, init);
+    rows_.assign(y_size, init);
+
+    int selected_x = 0;
+    int selected_y = 0;
+    int shortest_line = x_size;
+    for (int y = 0; y < y_size; ++y) {
+      auto& line = lines_[y];
+      auto& row = rows_[y];
+      for (int x = 0; x < int(line.size()); ++x) {
+        line[x]->ComputeRequirement();
+        const Requirement requirement = line[x]->requirement();
+        auto& column = columns_[x];
+        column.min_size = std::max(column.min_size, requirement.min_x);
+        row.min_size = std::max(row.min_size, requirement.min_y);
+        column.flex_grow = std::min(column.flex_grow, requirement.flex_grow_x);
+        row.flex_grow = std::min(row.flex_grow, requirement.flex_grow_y);
+        column.flex_shrink =
+            std::min(column.flex_shrink, requirement.flex_shrink_x);
+        row.flex_shrink = std::min(row.flex_shrink, requirement.flex_shrink_y);
+
+        // Forward the selected/focused child state. The first one, column by
+        // column, is used.
+        if (requirement_.selection < requirement.selection ||
+            (requirement_.selection == requirement.selection &&
+             requirement.selection != Requirement::NORMAL &&
+             x < selected_x)) {
+          requirement_.selection = requirement.selection;
+          requirement_.selected_box = requirement.selected_box;
+          selected_x = x;
+          selected_y = y;
+        }
       }
-    }
 
-    // Compute the size of each columns/row.
-    std::vector<int> size_x(x_size, 0);
-    std::vector<int> size_y(y_size, 0);
-    for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        size_x[x] = std::max(size_x[x], lines_[y][x]->requirement().min_x);
-        size_y[y] = std::max(size_y[y], lines_[y][x]->requirement().min_y);
+      // The missing cells are empty and flexible, like ftxui::filler().
+      if (int(line.size()) < x_size) {
+        row.flex_grow = std::min(row.flex_grow, 1);
+        row.flex_shrink = std::min(row.flex_shrink, 1);
+        shortest_line = std::min(shortest_line, int(line.size()));
       }
     }
+    for (int x = shortest_line; x < x_size; ++x) {
+      columns_[x].flex_grow = std::min(columns_[x].flex_grow, 1);
+      columns_[x].flex_shrink = std::min(columns_[x].flex_shrink, 1);
+    }
 
-    requirement_.min_x = Integrate(size_x);
-    requirement_.min_y = Integrate(size_y);
-
-    // Forward the selected/focused child state:
-    requirement_.selection = Requirement::NORMAL;
     for (int x = 0; x < x_size; ++x) {
-      for (int y = 0; y < y_size; ++y) {
-        if (requirement_.selection >= lines_[y][x]->requirement().selection) {
-          continue;
-        }
-        requirement_.selection = lines_[y][x]->requirement().selection;
-        requirement_.selected_box = lines_[y][x]->requirement().selected_box;
-        requirement_.selected_box.x_min += size_x[x];
-        requirement_.selected_box.x_max += size_x[x];
-        requirement_.selected_box.y_min += size_y[y];
-        requirement_.selected_box.y_max += size_y[y];
+      if (x == selected_x) {
+        requirement_.selected_box.x_min += requirement_.min_x;
+        requirement_.selected_box.x_max += requirement_.min_x;
+      }
+      requirement_.min_x += columns_[x].min_size;
+    }
+    for (int y = 0; y < y_size; ++y) {
+      if (y == selected_y) {
+        requirement_.selected_box.y_min += requirement_.min_y;
+        requirement_.selected_box.y_max += requirement_.min_y;
       }
+      requirement_.min_y += rows_[y].min_size;
     }
   }
 
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    box_helper::Element init;
-    init.min_size = 0;
-    init.flex_grow = 1024;    // NOLINT
-    init.flex_shrink = 1024;  // NOLINT
-    std::vector<box_helper::Element> elements_x(x_size, init);
-    std::vector<box_helper::Element> elements_y(y_size, init);
-
-    for (int y = 0; y < y_size; ++y) {
-      for (int x = 0; x < x_size; ++x) {
-        const auto& cell = lines_[y][x];
-        const auto& requirement = cell->requirement();
-        auto& e_x = elements_x[x];
-        auto& e_y = elements_y[y];
-        e_x.min_size = std::max(e_x.min_size, requirement.min_x);
-        e_y.min_size = std::max(e_y.min_size, requirement.min_y);
-        e_x.flex_grow = std::min(e_x.flex_grow, requirement.flex_grow_x);
-        e_y.flex_grow = std::min(e_y.flex_grow, requirement.flex_grow_y);
-        e_x.flex_shrink = std::min(e_x.flex_shrink, requirement.flex_shrink_x);
-        e_y.flex_shrink = std::min(e_y.flex_shrink, requirement.flex_shrink_y);
-      }
-    }
-
+    // The columns/rows were measured by ComputeRequirement().
     const int target_size_x = box.x_max - box.x_min + 1;
     const int target_size_y = box.y_max - box.y_min + 1;
-    box_helper::Compute(&elements_x, target_size_x);
-    box_helper::Compute(&elements_y, target_size_y);
+    box_helper::Compute(&columns_, target_size_x);
+    box_helper::Compute(&rows_, target_size_y);
 
     Box box_y = box;
     int y = box_y.y_min;
+    rows_y_.resize(y_size);
     for (int iy = 0; iy < y_size; ++iy) {
+      rows_y_[iy] = y;
       box_y.y_min = y;
-      y += elements_y[iy].size;
+      y += rows_[iy].size;
       box_y.y_max = y - 1;
 
       Box box_x = box_y;
       int x = box_x.x_min;
-      for (int ix = 0; ix < x_size; ++ix) {
+      for (size_t ix = 0; ix < lines_[iy].size(); ++ix) {
         box_x.x_min = x;
-        x += elements_x[ix].size;
+        x += columns_[ix].size;
         box_x.x_max = x - 1;
         lines_[iy][ix]->SetBox(box_x);
       }
     }
   }
-
+  // Rows are laid out one after the other. Only the visible ones are looked
+  // for and drawn.
   void Render(Screen& screen) override {
+    auto it = std::upper_bound(rows_y_.begin(), rows_y_.end(),
+                               screen.stencil.y_min);
+    if (it != rows_y_.begin()) {
+      --it;
+    }
+    for (; it != rows_y_.end() && *it <= screen.stencil.y_max; ++it) {
+      for (auto& cell : lines_[it - rows_y_.begin()]) {
+        if (IsVisible(*cell, screen)) {
+          cell->Render(screen);
+        }
+      }
+    }
+  }
+
+  void Compile(DisplayList& list) override {
+    for (auto& line : lines_) {
+      for (auto& cell : line) {
+        cell->Compile(list);
+      }
+    }
+  }
+
+  // The cells are stored into |lines_| instead of |children_|.
+  bool Hash(size_t* hash) override {
+    HashValue(hash, x_size);
+    HashValue(hash, y_size);
     for (auto& line : lines_) {
+      HashValue(hash, line.size());
       for (auto& cell : line) {
-        cell->Render(screen);
+        if (!cell->Hash(hash)) {
+          return false;
+        }
       }
     }
+    return HashChildren(hash);
   }
 
   int x_size = 0;
   int y_size = 0;
   std::vector<Elements> lines_;
+
+  // The size and flexibility of the columns/rows. Reused from one frame to the
+  // next.
+  std::vector<box_helper::Element> columns_;
+  std::vector<box_helper::Element> rows_;
+  std::vector<int> rows_y_;  // The position of each row.
 };
 
 /// @brief A container displaying a grid of elements.
@@ -596,6 +596,29 @@ TEST(GridboxTest, MissingCells) {
             "                    ");
 }
 
+TEST(GridboxTest, MissingCellsAreFillers) {
+  auto root = gridbox({
+      {cell("1"), cell("2") | flex, cell("3")},
+      {cell("4") | yflex, cell("5")},
+      {},
+  });
+  auto expected = gridbox({
+      {cell("1"), cell("2") | flex, cell("3")},
+      {cell("4") | yflex, cell("5"), filler()},
+      {filler(), filler(), filler()},
+  });
+
+  for (int x = 0; x < 15; ++x) {
+    for (int y = 0; y < 10; ++y) {
+      Screen screen(x, y);
+      Render(screen, root);
+      Screen expected_screen(x, y);
+      Render(expected_screen, expected);
+      EXPECT_EQ(screen.ToString(), expected_screen.ToString());
+    }
+  }
+}
+
 TEST(GridboxTest, Focus) {
   auto root = gridbox({
       {cell("1"), cell("2"), cell("3"), cell("4")},
@@ -0,0 +1,70 @@
+#include <cstdint>  // for uint32_t
+#include <cstring>  // for memcpy
+
+#include "ftxui/dom/hash.hpp"
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/style.hpp"        // for Style
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Pixel
+
+namespace ftxui {
+
+void HashValue(size_t* hash, const Box& box) {
+  HashValue(hash, box.x_min);
+  HashValue(hash, box.x_max);
+  HashValue(hash, box.y_min);
+  HashValue(hash, box.y_max);
+}
+
+void HashValue(size_t* hash, const Color& color) {
+  // A Color is a plain value made of four bytes.
+  static_assert(sizeof(Color) == sizeof(uint32_t), "Unexpected Color layout");
+  uint32_t value = 0;
+  std::memcpy(&value, &color, sizeof(value));
+  HashValue(hash, value);
+}
+
+void HashValue(size_t* hash, const Pixel& pixel) {
+  HashValue(hash, pixel.character);
+  HashValue(hash, pixel.hyperlink);
+  HashValue(hash, pixel.background_color);
+  HashValue(hash, pixel.foreground_color);
+  const int attributes = (pixel.blink << 0) |              //
+                         (pixel.bold << 1) |               //
+                         (pixel.dim << 2) |                //
+                         (pixel.inverted << 3) |           //
+                         (pixel.underlined << 4) |         //
+                         (pixel.underlined_double << 5) |  //
+                         (pixel.strikethrough << 6) |      //
+                         (pixel.automerge << 7);           //
+  HashValue(hash, attributes);
+}
+
+void HashValue(size_t* hash, const Requirement& requirement) {
+  HashValue(hash, requirement.min_x);
+  HashValue(hash, requirement.min_y);
+  HashValue(hash, requirement.flex_grow_x);
+  HashValue(hash, requirement.flex_grow_y);
+  HashValue(hash, requirement.flex_shrink_x);
+  HashValue(hash, requirement.flex_shrink_y);
+  HashValue(hash, requirement.selection);
+  HashValue(hash, requirement.selected_box);
+}
+
+void HashValue(size_t* hash, const Style& style) {
+  HashValue(hash, style.set);
+  HashValue(hash, style.toggle);
+  if (style.set & Style::kForegroundColor) {
+    HashValue(hash, style.foreground_color);
+  }
+  if (style.set & Style::kBackgroundColor) {
+    HashValue(hash, style.background_color);
+  }
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
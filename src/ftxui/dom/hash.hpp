@@ -0,0 +1,38 @@
+#ifndef FTXUI_DOM_HASH_HPP
+#define FTXUI_DOM_HASH_HPP
+
+#include <cstddef>     // for size_t
+#include <functional>  // for hash
+
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/dom/style.hpp"        // for Style
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Pixel
+
+namespace ftxui {
+
+// Helpers to implement Node::Hash().
+
+inline void HashCombine(size_t* hash, size_t value) {
+  *hash ^= value + 0x9e3779b9 + (*hash << 6) + (*hash >> 2);  // NOLINT
+}
+
+template <typename T>
+void HashValue(size_t* hash, const T& value) {
+  HashCombine(hash, std::hash<T>()(value));
+}
+
+void HashValue(size_t* hash, const Box& box);
+void HashValue(size_t* hash, const Color& color);
+void HashValue(size_t* hash, const Pixel& pixel);
+void HashValue(size_t* hash, const Requirement& requirement);
+void HashValue(size_t* hash, const Style& style);
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_HASH_HPP */
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, EXPECT_NE, TEST
+#include <cstddef>        // for size_t
+#include <string>         // for string, to_string
+#include <vector>         // for vector
+
+#include "ftxui/dom/elements.hpp"  // for text, border, vbox, hbox, gauge, color, bold, separator, gridbox, graph, frame, focus, operator|, Element
+#include "ftxui/dom/node.hpp"      // for Node
+#include "ftxui/screen/color.hpp"  // for Color, Color::Red, Color::Blue
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Element Document(const std::string& value, Color value_color, int selected) {
+  Elements lines;
+  for (int i = 0; i < 10; ++i) {
+    Element line = hbox({
+        text("line " + std::to_string(i)) | bold,
+        separator(),
+        text(value) | color(value_color),
+        gauge(0.5f),
+    });
+    if (i == selected) {
+      line |= focus;
+    }
+    lines.push_back(line);
+  }
+  return window(text("Title"), vbox(std::move(lines)) | frame);
+}
+
+bool Hash(Element element, size_t* hash) {
+  element->ComputeRequirement();
+  *hash = 0;
+  return element->Hash(hash);
+}
+
+size_t Hash(Element element) {
+  size_t hash = 0;
+  EXPECT_TRUE(Hash(element, &hash));
+  return hash;
+}
+
+}  // namespace
+
+TEST(HashTest, SameDocument) {
+  EXPECT_EQ(Hash(Document("value", Color::Red, 3)),
+            Hash(Document("value", Color::Red, 3)));
+}
+
+TEST(HashTest, Content) {
+  EXPECT_NE(Hash(Document("value", Color::Red, 3)),
+            Hash(Document("other", Color::Red, 3)));
+  EXPECT_NE(Hash(text("a")), Hash(text("b")));
+  EXPECT_NE(Hash(gauge(0.5f)), Hash(gauge(0.6f)));
+}
+
+TEST(HashTest, Style) {
+  EXPECT_NE(Hash(Document("value", Color::Red, 3)),
+            Hash(Document("value", Color::Blue, 3)));
+  EXPECT_NE(Hash(text("a")), Hash(text("a") | bold));
+  EXPECT_NE(Hash(text("a") | bold), Hash(text("a") | dim));
+}
+
+TEST(HashTest, Structure) {
+  EXPECT_NE(Hash(Document("value", Color::Red, 3)),
+            Hash(Document("value", Color::Red, 4)));
+  EXPECT_NE(Hash(hbox({text("a"), text("b")})),
+            Hash(vbox({text("a"), text("b")})));
+  EXPECT_NE(Hash(hbox({text("ab")})), Hash(hbox({text("a"), text("b")})));
+  EXPECT_NE(Hash(gridbox({{text("a"), text("b")}})),
+            Hash(gridbox({{text("a")}, {text("b")}})));
+}
+
+TEST(HashTest, Unhashable) {
+  // The content of a graph is produced while drawing it.
+  auto function = [](int width, int) { return std::vector<int>(width, 1); };
+  size_t hash = 0;
+  EXPECT_FALSE(Hash(graph(function), &hash));
+  EXPECT_FALSE(Hash(vbox({text("a"), graph(function) | border}), &hash));
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,14 +1,17 @@
-#include <algorithm>  // for max
+#include <algorithm>  // for max, partition_point
 #include <cstddef>    // for size_t
 #include <memory>  // for __shared_ptr_access, shared_ptr, make_shared, allocator_traits<>::value_type
 #include <utility>  // for move
 #include <vector>   // for vector, __alloc_traits<>::value_type
 
-#include "ftxui/dom/box_helper.hpp"   // for Element, Compute
-#include "ftxui/dom/elements.hpp"     // for Element, Elements, hbox
-#include "ftxui/dom/node.hpp"         // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/box_helper.hpp"    // for Element, Sums, Distribution
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Element, Elements, hbox
+#include "ftxui/dom/node.hpp"          // for Node, Elements
+#include "ftxui/dom/parallel.hpp"      // for Enabled, ComputeRequirement, SetBox, Render
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/screen.hpp"     // for Screen
 
 namespace ftxui {
 
@@ -24,42 +27,92 @@ class HBox : public Node {
     requirement_.flex_shrink_x = 0;
     requirement_.flex_shrink_y = 0;
     requirement_.selection = Requirement::NORMAL;
+    sums_ = box_helper::Sums();
+    const bool parallel = parallel_helper::Enabled();
+    if (parallel) {
+      parallel_helper::ComputeRequirement(children_);
+    }
     for (auto& child : children_) {
-      child->ComputeRequirement();
-      if (requirement_.selection < child->requirement().selection) {
-        requirement_.selection = child->requirement().selection;
-        requirement_.selected_box = child->requirement().selected_box;
+      if (!parallel) {
+        child->ComputeRequirement();
+      }
+      const Requirement requirement = child->requirement();
+      sums_.Add(LayoutElement(requirement));
+      if (requirement_.selection < requirement.selection) {
+        requirement_.selection = requirement.selection;
+        requirement_.selected_box = requirement.selected_box;
         requirement_.selected_box.x_min += requirement_.min_x;
         requirement_.selected_box.x_max += requirement_.min_x;
       }
-      requirement_.min_x += child->requirement().min_x;
-      requirement_.min_y =
-          std::max(requirement_.min_y, child->requirement().min_y);
+      requirement_.min_x += requirement.min_x;
+      requirement_.min_y = std::max(requirement_.min_y, requirement.min_y);
     }
   }
 
   void SetBox(Box box) override {
     Node::SetBox(box);
 
-    std::vector<box_helper::Element> elements(children_.size());
-    for (size_t i = 0; i < children_.size(); ++i) {
-      auto& element = elements[i];
-      const auto& requirement = children_[i]->requirement();
-      element.min_size = requirement.min_x;
-      element.flex_grow = requirement.flex_grow_x;
-      element.flex_shrink = requirement.flex_shrink_x;
-    }
-    const int target_size = box.x_max - box.x_min + 1;
-    box_helper::Compute(&elements, target_size);
-
+    // The sums were accumulated by ComputeRequirement(), so the children are
+    // laid out in a single pass, without allocating.
+    box_helper::Distribution distribution(sums_, box.x_max - box.x_min + 1);
+    const bool parallel = parallel_helper::Enabled();
+    std::vector<Box> boxes;
     int x = box.x_min;
-    for (size_t i = 0; i < children_.size(); ++i) {
+    for (auto& child : children_) {
+      const int size = distribution.Next(LayoutElement(child->requirement()));
       box.x_min = x;
-      box.x_max = x + elements[i].size - 1;
-      children_[i]->SetBox(box);
+      box.x_max = x + size - 1;
+      if (parallel) {
+        boxes.push_back(box);
+      } else {
+        child->SetBox(box);
+      }
       x = box.x_max + 1;
     }
+    if (parallel) {
+      parallel_helper::SetBox(children_, boxes);
+    }
   }
+
+  // Children are laid out one after the other. Only the visible ones are
+  // looked for and drawn.
+  void Render(Screen& screen) override {
+    if (parallel_helper::Enabled()) {
+      parallel_helper::Render(screen, children_);
+      return;
+    }
+    auto it = std::partition_point(
+        children_.begin(), children_.end(), [&](const Element& child) {
+          return child->box().x_max < screen.stencil.x_min;
+        });
+    for (; it != children_.end(); ++it) {
+      if ((*it)->box().x_min > screen.stencil.x_max) {
+        break;
+      }
+      if (IsVisible(**it, screen)) {
+        (*it)->Render(screen);
+      }
+    }
+  }
+
+  void Compile(DisplayList& list) override {
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+  }
+
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
+
+ private:
+  static box_helper::Element LayoutElement(const Requirement& requirement) {
+    box_helper::Element element;
+    element.min_size = requirement.min_x;
+    element.flex_grow = requirement.flex_grow_x;
+    element.flex_shrink = requirement.flex_shrink_x;
+    return element;
+  }
+
+  box_helper::Sums sums_;
 };
 
 /// @brief A container displaying elements horizontally one by one.
@@ -3,8 +3,9 @@
 #include <string>   // for allocator, basic_string, string
 #include <vector>   // for vector
 
-#include "ftxui/dom/elements.hpp"  // for text, operator|, Element, flex_grow, flex_shrink, hbox
+#include "ftxui/dom/elements.hpp"   // for text, operator|, Element, flex_grow, flex_shrink, hbox
 #include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/box.hpp"     // for Box
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 // NOLINTBEGIN
@@ -355,6 +356,53 @@ TEST(HBoxTest, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+// Layout a hbox made of many children, one of four being flexible.
+TEST(HBoxTest, ManyChildren) {
+  const int count = 50000;
+  Elements lines;
+  Elements children;
+  for (int i = 0; i < count; ++i) {
+    lines.push_back(text("x"));
+    children.push_back(i % 4 ? lines.back() : lines.back() | flex);
+  }
+  auto root = hbox(std::move(children));
+  root->ComputeRequirement();
+
+  const int flexible_count = count / 4;
+  const int rigid_count = count - flexible_count;
+  for (const int size : {count * 2, count, count * 9 / 10, count / 2}) {
+    root->SetBox(Box{0, size - 1, 0, 0});
+    int x = 0;
+    for (int i = 0; i < count; ++i) {
+      const Box box = lines[i]->box();
+      const int child_size = box.x_max - box.x_min + 1;
+      EXPECT_EQ(box.x_min, x);
+      const bool flexible = i % 4 == 0;
+      // The index of the child among the flexible, or the other children.
+      const int flexible_index = i / 4;
+      const int rigid_index = i - flexible_index - 1;
+      if (size >= count) {
+        // Growing: The extra space is split among the flexible children.
+        const int grown = 1 + (size - count) / flexible_count;
+        EXPECT_EQ(child_size, flexible ? grown : 1);
+      } else if (size >= rigid_count) {
+        // Shrinking: The last flexible children absorb the missing space.
+        const int missing = count - size;
+        const bool emptied = flexible_index >= flexible_count - missing;
+        EXPECT_EQ(child_size, flexible && emptied ? 0 : 1);
+      } else {
+        // Shrinking more than the flexible children can absorb: they are all
+        // emptied, and so are the last other children.
+        const int missing = rigid_count - size;
+        const bool emptied = rigid_index >= rigid_count - missing;
+        EXPECT_EQ(child_size, flexible || emptied ? 0 : 1);
+      }
+      x += child_size;
+    }
+    EXPECT_EQ(x, size);
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -0,0 +1,207 @@
+#include <algorithm>  // for copy, max, min
+#include <cstddef>    // for size_t
+#include <cstdint>    // for uint8_t
+#include <memory>     // for make_shared
+#include <string>     // for string
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/color_map.hpp"    // for ColorMap
+#include "ftxui/dom/color_table.hpp"  // for ColorTable
+#include "ftxui/dom/elements.hpp"     // for Element, heatmap
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Pixel, PixelSpan, Screen
+
+namespace ftxui {
+namespace {
+
+// The number of steps of the color table.
+constexpr int kSteps = 255;
+
+// The top half of a cell gets the foreground color, the bottom half gets the
+// background color.
+const std::string kUpperHalf = "▀";  // NOLINT
+
+class Heatmap : public Node {
+ public:
+  Heatmap(const float* data, int rows, int cols, ColorMap color_map)
+      : data_(data),
+        rows_(rows),
+        cols_(cols),
+        color_map_(std::move(color_map)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = std::max(0, cols_);
+    requirement_.min_y = std::max(0, (rows_ + 1) / 2);
+  }
+
+  void Render(Screen& screen) override {
+    const int width = box_.x_max - box_.x_min + 1;
+    const int height = box_.y_max - box_.y_min + 1;
+    if (width <= 0 || height <= 0 || rows_ <= 0 || cols_ <= 0) {
+      return;
+    }
+    const std::vector<Color>& table =
+        table_.Get(kSteps, [&](float t) { return Sample(t); });
+
+    // The index in the table of a value is |value| * scale + offset. It is
+    // decreasing for a reversed range.
+    const float extent = color_map_.high - color_map_.low;
+    const float scale = extent != 0.f ? float(kSteps) / extent : 0.f;
+    const float offset = 0.5f - color_map_.low * scale;
+
+    // The data is stretched to fill the box. Every cell shows two rows, so an
+    // odd number of rows leaves the bottom half of the last cells empty.
+    const auto cells = static_cast<size_t>(width);
+    std::vector<int> columns(cells);
+    for (int x = 0; x < width; ++x) {
+      columns[size_t(x)] = x * cols_ / width;
+    }
+    const int halves = rows_ + rows_ % 2;
+
+    std::vector<float> values(cells);
+    std::vector<uint8_t> top(cells);
+    std::vector<uint8_t> bottom(cells);
+    auto map_row = [&](int row, int first, int size, uint8_t* out) {
+      const float* const data = data_ + ptrdiff_t(row) * cols_;
+      if (width == cols_) {
+        std::copy(data + first, data + first + size, values.data());
+      } else {
+        for (int i = 0; i < size; ++i) {
+          values[size_t(i)] = data[columns[size_t(first + i)]];
+        }
+      }
+      // A branch free loop, so that it is vectorized. NaN maps to the lowest
+      // color.
+      for (int i = 0; i < size; ++i) {
+        const float index = values[size_t(i)] * scale + offset;
+        out[i] = uint8_t(index >= 0.f ? std::min(index, float(kSteps)) : 0.f);
+      }
+    };
+
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    for (int y = y_min; y <= y_max; ++y) {
+      const PixelSpan span = screen.RowSpan(y, box_.x_min, box_.x_max);
+      if (span.size == 0) {
+        continue;
+      }
+      const int half = 2 * (y - box_.y_min);
+      const int row_top = half * halves / (2 * height);
+      const int row_bottom = (half + 1) * halves / (2 * height);
+      const int first = span.x - box_.x_min;
+
+      if (row_top >= rows_) {
+        for (Pixel& pixel : span) {
+          pixel.character = " ";
+          pixel.foreground_color = Color::Default;
+          pixel.background_color = Color::Default;
+        }
+        continue;
+      }
+      map_row(row_top, first, span.size, top.data());
+      const bool has_bottom = row_bottom < rows_;
+      if (has_bottom) {
+        map_row(row_bottom, first, span.size, bottom.data());
+      }
+
+      for (int i = 0; i < span.size; ++i) {
+        Pixel& pixel = span.data[i];
+        pixel.character = kUpperHalf;
+        pixel.foreground_color = table[top[size_t(i)]];
+        pixel.background_color =
+            has_bottom ? table[bottom[size_t(i)]] : Color::Default;
+      }
+    }
+  }
+
+ private:
+  // The color of the map at |t|, from 0 for the first color to 1 for the
+  // last one.
+  Color Sample(float t) const {
+    const std::vector<Color>& colors = color_map_.colors;
+    if (colors.size() < 2) {
+      return colors.empty() ? Color() : colors[0];
+    }
+    const float position = t * float(colors.size() - 1);
+    const size_t stop = std::min(size_t(position), colors.size() - 2);
+    return Color::Interpolate(position - float(stop), colors[stop],
+                              colors[stop + 1]);
+  }
+
+  const float* data_;
+  int rows_;
+  int cols_;
+  ColorMap color_map_;
+  ColorTable table_;
+};
+
+}  // namespace
+
+/// @brief Build the "empty" color map. This is often followed by calls to
+/// ColorMap::Stop() and ColorMap::Range().
+/// @ingroup dom
+ColorMap::ColorMap() = default;
+
+/// @brief Build a color map with two colors, for the values in [0, 1].
+/// @param begin The color of the lowest value.
+/// @param end The color of the highest value.
+/// @ingroup dom
+ColorMap::ColorMap(Color begin, Color end) : colors({begin, end}) {}
+
+/// @brief Set the range of the values.
+/// @param l The value getting the first color.
+/// @param h The value getting the last color.
+/// @return The color map.
+/// @ingroup dom
+/// @note |l| may be greater than |h|, reversing the colors. When they are
+/// equal, every value gets the first color.
+ColorMap& ColorMap::Range(float l, float h) {
+  low = l;
+  high = h;
+  return *this;
+}
+
+/// @brief Add a color after the others.
+/// @param c The color.
+/// @return The color map.
+/// @ingroup dom
+ColorMap& ColorMap::Stop(Color c) {
+  colors.push_back(c);
+  return *this;
+}
+
+/// @brief Draw a matrix of values as colored cells.
+/// @param data the values, row by row. It must outlive the element.
+/// @param rows the number of rows of |data|.
+/// @param cols the number of columns of |data|.
+/// @param color_map the color of the values.
+/// @ingroup dom
+///
+/// Every cell shows two rows of the matrix using the "▀" character: the top
+/// one with its foreground color, the bottom one with its background color.
+/// The colors are read from a table computed once, in the color depth of the
+/// terminal, and written directly into the screen.
+///
+/// The element requests one cell per column and one per pair of rows. The
+/// matrix is stretched when given more space.
+///
+/// ### Example
+///
+/// ```cpp
+/// std::vector<float> usage(cores * seconds);
+/// Element document = heatmap(usage.data(), cores, seconds,
+///                            ColorMap(Color::Blue, Color::Red));
+/// ```
+Element heatmap(const float* data, int rows, int cols, ColorMap color_map) {
+  return std::make_shared<Heatmap>(data, rows, cols, std::move(color_map));
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
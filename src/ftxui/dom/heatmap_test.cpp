@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, EXPECT_NE, TEST
+#include <cmath>          // for NAN
+#include <vector>         // for vector
+
+#include "ftxui/dom/color_map.hpp"    // for ColorMap
+#include "ftxui/dom/elements.hpp"     // for heatmap, operator|, size
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/screen/color.hpp"     // for Color
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/screen/terminal.hpp"  // for ColorSupport, SetColorSupport
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(HeatmapTest, API_builder) {
+  auto color_map = ColorMap()  //
+                       .Stop(Color::Black)
+                       .Stop(Color::Red)
+                       .Range(-1.f, 2.f);
+  EXPECT_EQ(color_map.colors.size(), 2);
+  EXPECT_EQ(color_map.colors[0], Color::Black);
+  EXPECT_EQ(color_map.colors[1], Color::Red);
+  EXPECT_EQ(color_map.low, -1.f);
+  EXPECT_EQ(color_map.high, 2.f);
+}
+
+TEST(HeatmapTest, Basic) {
+  const Terminal::Color support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const Color low = Color::RGB(0, 0, 0);
+  const Color high = Color::RGB(255, 0, 0);
+  // The ends of the table, as given by Color::Interpolate.
+  const Color black = Color::Interpolate(0.f, low, high);
+  const Color red = Color::Interpolate(1.f, low, high);
+
+  // Three rows: the bottom half of the second line of cells is empty. The
+  // values out of range and NaN are clamped.
+  const std::vector<float> data = {
+      0.f, 1.f, 5.f,   //
+      1.f, 0.f, -5.f,  //
+      1.f, NAN, 0.f,   //
+  };
+  Screen screen(3, 2);
+  Render(screen, heatmap(data.data(), 3, 3, ColorMap(low, high)));
+
+  EXPECT_EQ(screen.PixelAt(0, 0).character, "▀");
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, black);
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color, red);
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color, red);
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color, black);
+  EXPECT_EQ(screen.PixelAt(2, 0).foreground_color, red);
+  EXPECT_EQ(screen.PixelAt(2, 0).background_color, black);
+  EXPECT_EQ(screen.PixelAt(0, 1).character, "▀");
+  EXPECT_EQ(screen.PixelAt(0, 1).foreground_color, red);
+  EXPECT_EQ(screen.PixelAt(0, 1).background_color, Color::Default);
+  EXPECT_EQ(screen.PixelAt(1, 1).foreground_color, black);
+  EXPECT_EQ(screen.PixelAt(2, 1).foreground_color, black);
+
+  Terminal::SetColorSupport(support);
+}
+
+TEST(HeatmapTest, ReversedRange) {
+  const Terminal::Color support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const Color low = Color::RGB(0, 0, 0);
+  const Color high = Color::RGB(255, 0, 0);
+
+  // The first color is for 10, the last one for 0.
+  const std::vector<float> data = {
+      10.f, 0.f, 5.f,   //
+      20.f, -5.f, 5.f,  //
+  };
+  Screen screen(3, 1);
+  Render(screen, heatmap(data.data(), 2, 3,
+                         ColorMap(low, high).Range(10.f, 0.f)));
+
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color,
+            Color::Interpolate(0.f, low, high));
+  EXPECT_EQ(screen.PixelAt(0, 0).background_color,
+            Color::Interpolate(0.f, low, high));
+  EXPECT_EQ(screen.PixelAt(1, 0).foreground_color,
+            Color::Interpolate(1.f, low, high));
+  EXPECT_EQ(screen.PixelAt(1, 0).background_color,
+            Color::Interpolate(1.f, low, high));
+  EXPECT_EQ(screen.PixelAt(2, 0).foreground_color,
+            screen.PixelAt(2, 0).background_color);
+  EXPECT_NE(screen.PixelAt(2, 0).foreground_color,
+            Color::Interpolate(0.f, low, high));
+  EXPECT_NE(screen.PixelAt(2, 0).foreground_color,
+            Color::Interpolate(1.f, low, high));
+
+  Terminal::SetColorSupport(support);
+}
+
+TEST(HeatmapTest, Stretch) {
+  const Terminal::Color support = Terminal::ColorSupport();
+  Terminal::SetColorSupport(Terminal::Color::TrueColor);
+  const Color low = Color::RGB(0, 0, 0);
+  const Color high = Color::RGB(255, 0, 0);
+  // The ends of the table, as given by Color::Interpolate.
+  const Color black = Color::Interpolate(0.f, low, high);
+  const Color red = Color::Interpolate(1.f, low, high);
+
+  // A 2x2 matrix drawn in 4x2 cells: every value covers 2x2 halves.
+  const std::vector<float> data = {
+      0.f, 1.f,  //
+      1.f, 0.f,  //
+  };
+  auto document = heatmap(data.data(), 2, 2, ColorMap(low, high)) |
+                  size(WIDTH, EQUAL, 4) | size(HEIGHT, EQUAL, 2);
+  Screen screen(4, 2);
+  Render(screen, document);
+
+  for (int x = 0; x < 4; ++x) {
+    const Color top = x < 2 ? black : red;
+    const Color bottom = x < 2 ? red : black;
+    EXPECT_EQ(screen.PixelAt(x, 0).foreground_color, top);
+    EXPECT_EQ(screen.PixelAt(x, 0).background_color, top);
+    EXPECT_EQ(screen.PixelAt(x, 1).foreground_color, bottom);
+    EXPECT_EQ(screen.PixelAt(x, 1).background_color, bottom);
+  }
+
+  Terminal::SetColorSupport(support);
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
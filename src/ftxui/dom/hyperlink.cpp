@@ -4,6 +4,7 @@
 #include <utility>  // for move
 
 #include "ftxui/dom/elements.hpp"        // for Element, Decorator, hyperlink
+#include "ftxui/dom/hash.hpp"            // for HashValue
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
 #include "ftxui/screen/screen.hpp"       // for Screen, Pixel
@@ -17,14 +18,16 @@ class Hyperlink : public NodeDecorator {
 
   void Render(Screen& screen) override {
     const uint8_t hyperlink_id = screen.RegisterHyperlink(link_);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).hyperlink = hyperlink_id;
-      }
-    }
+    screen.ForEachPixel(box_,
+                        [&](Pixel& pixel) { pixel.hyperlink = hyperlink_id; });
     NodeDecorator::Render(screen);
   }
 
+  bool Hash(size_t* hash) override {
+    HashValue(hash, link_);
+    return HashChildren(hash);
+  }
+
   std::string link_;
 };
 
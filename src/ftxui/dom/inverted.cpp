@@ -1,33 +1,16 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, inverted
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, inverted
+#include "ftxui/dom/style.hpp"     // for Style
+#include "ftxui/dom/styled.hpp"    // for Stylize
 
 namespace ftxui {
 
-class Inverted : public NodeDecorator {
- public:
-  using NodeDecorator::NodeDecorator;
-
-  void Render(Screen& screen) override {
-    Node::Render(screen);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).inverted ^= true;
-      }
-    }
-  }
-};
-
 /// @brief Add a filter that will invert the foreground and the background
 /// colors.
 /// @ingroup dom
 Element inverted(Element child) {
-  return std::make_shared<Inverted>(std::move(child));
+  return Stylize(std::move(child), {}, Style::Toggle(Style::kInverted));
 }
 
 }  // namespace ftxui
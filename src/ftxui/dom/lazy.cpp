@@ -0,0 +1,83 @@
+#include <functional>  // for function
+#include <memory>      // for make_shared
+#include <utility>     // for move
+
+#include "ftxui/dom/elements.hpp"     // for Element, lazy
+#include "ftxui/dom/node.hpp"         // for Node, Layout
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+namespace ftxui {
+
+namespace {
+
+class Lazy : public Node {
+ public:
+  Lazy(Requirement hint, std::function<Element()> factory)
+      : hint_(hint), factory_(std::move(factory)) {}
+
+  void ComputeRequirement() override { requirement_ = hint_; }
+
+  void SetBox(Box box) override {
+    Node::SetBox(box);
+    // The element is built again, the next time it is drawn.
+    children_.clear();
+  }
+
+  void Render(Screen& screen) override {
+    if (Box::Intersection(box_, screen.stencil).IsEmpty()) {
+      return;
+    }
+    if (children_.empty()) {
+      Build();
+    }
+    Node::Render(screen);
+  }
+
+ private:
+  // Build the element, and lay it out inside the box.
+  void Build() {
+    Element child = factory_();
+    if (!child) {
+      return;
+    }
+    Layout(child.get(), box_);
+    children_.push_back(std::move(child));
+  }
+
+  Requirement hint_;
+  std::function<Element()> factory_;
+};
+
+}  // namespace
+
+/// @brief An element built only when it is drawn, while being visible.
+/// Elements outside of the visible area, like the ones scrolled out of a
+/// `frame`, never pay for building their content.
+/// @param hint The requirement used for the layout, in place of the one of the
+///             element.
+/// @param factory The function building the element.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Requirement hint;
+/// hint.min_x = 80;
+/// hint.min_y = 20;
+/// Elements sections;
+/// for (int i = 0; i < 40; ++i) {
+///   sections.push_back(lazy(hint, [i] { return Section(i); }));
+/// }
+/// Element document = vbox(std::move(sections)) | frame;
+/// ```
+Element lazy(Requirement hint, std::function<Element()> factory) {
+  return std::make_shared<Lazy>(hint, std::move(factory));
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
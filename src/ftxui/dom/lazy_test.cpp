@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <string>         // for string, to_string
+
+#include "ftxui/dom/elements.hpp"     // for text, vbox, frame, border, lazy, focus, operator|, Element
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Requirement Hint(int min_x, int min_y) {
+  Requirement requirement;
+  requirement.min_x = min_x;
+  requirement.min_y = min_y;
+  return requirement;
+}
+
+}  // namespace
+
+TEST(LazyTest, Basic) {
+  auto element = lazy(Hint(4, 1), [] { return text("text"); }) | border;
+  Screen screen(6, 3);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(),
+            "╭────╮\r\n"
+            "│text│\r\n"
+            "╰────╯");
+}
+
+TEST(LazyTest, OnlyVisibleAreBuilt) {
+  int built = 0;
+  Elements sections;
+  for (int i = 0; i < 40; ++i) {
+    sections.push_back(lazy(Hint(10, 3), [&built, i] {
+      built++;
+      return vbox({
+          text("Section " + std::to_string(i)),
+          text("a"),
+          text("b"),
+      });
+    }));
+  }
+  sections[20] = sections[20] | focus;
+
+  Screen screen(10, 4);
+  Render(screen, vbox(std::move(sections)) | frame);
+  EXPECT_EQ(built, 2);
+  EXPECT_EQ(screen.ToString(),
+            "Section 20\r\n"
+            "a         \r\n"
+            "b         \r\n"
+            "Section 21");
+}
+
+TEST(LazyTest, Null) {
+  auto element = lazy(Hint(4, 1), [] { return Element(); });
+  Screen screen(6, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.ToString(), "      ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,5 +1,5 @@
-#include <algorithm>                      // for max, min, sort, copy
-#include <cmath>                          // for fmod, cos, sin
+#include <algorithm>                      // for max, min, sort, copy, clamp
+#include <cmath>                          // for fmod, cos, sin, lround
 #include <cstddef>                        // for size_t
 #include <ftxui/dom/linear_gradient.hpp>  // for LinearGradient::Stop, LinearGradient
 #include <memory>    // for allocator_traits<>::value_type, make_shared
@@ -7,15 +7,21 @@
 #include <utility>   // for move
 #include <vector>    // for vector
 
-#include "ftxui/dom/elements.hpp"  // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/color_table.hpp"     // for ColorTable
+#include "ftxui/dom/elements.hpp"        // for Element, Decorator, bgcolor, color
+#include "ftxui/dom/hash.hpp"            // for HashValue
 #include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
 #include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/color.hpp"   // for Color, Color::Default, Color::Blue
-#include "ftxui/screen/screen.hpp"  // for Pixel, Screen
+#include "ftxui/screen/color.hpp"        // for Color, Color::Default, Color::Blue
+#include "ftxui/screen/screen.hpp"       // for Pixel, PixelSpan, Screen
 
 namespace ftxui {
 namespace {
 
+// The bounds of the number of steps of the gradient tables.
+constexpr int kMinSteps = 255;
+constexpr int kMaxSteps = 4096;
+
 struct LinearGradientNormalized {
   float angle = 0.f;
   std::vector<Color> colors;
@@ -89,7 +95,7 @@ Color Interpolate(const LinearGradientNormalized& gradient, float t) {
   // Find the right color in the gradient's stops.
   size_t i = 1;
   while (true) {
-    if (i > gradient.positions.size()) {
+    if (i >= gradient.positions.size()) {
       // NOLINTNEXTLINE
       return Color::Interpolate(0.5f, gradient.colors.back(),
                                 gradient.colors.back());
@@ -140,28 +146,63 @@ class LinearGradientColor : public NodeDecorator {
     const float dY = dy / (max - min);
     const float dZ = -min / (max - min);
 
-    // Project every pixel to get the color.
-    if (background_color_) {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          const float t = float(x) * dX + float(y) * dY + dZ;
-          screen.PixelAt(x, y).background_color = Interpolate(gradient_, t);
-        }
-      }
-    } else {
-      for (int y = box_.y_min; y <= box_.y_max; ++y) {
-        for (int x = box_.x_min; x <= box_.x_max; ++x) {
-          const float t = float(x) * dX + float(y) * dY + dZ;
-          screen.PixelAt(x, y).foreground_color = Interpolate(gradient_, t);
-        }
+    Color Pixel::*const field = background_color_ ? &Pixel::background_color
+                                                  : &Pixel::foreground_color;
+
+    // A gradient along a single row or column: every pixel gets the same
+    // color.
+    const float extent = max - min;
+    if (!(extent > 0.f)) {
+      const Color color = Interpolate(
+          gradient_, float(box_.x_min) * dX + float(box_.y_min) * dY + dZ);
+      screen.ForEachPixel(box_, [&](Pixel& pixel) { pixel.*field = color; });
+      NodeDecorator::Render(screen);
+      return;
+    }
+
+    // Use at least kMinSteps steps, and a multiple of the number of cells
+    // along the gradient, so that the pixels of axis aligned gradients fall
+    // exactly on an entry of the table.
+    const int cells = std::max(1, int(std::lround(extent)));
+    const int steps =
+        std::min(kMaxSteps, cells * ((kMinSteps + cells - 1) / cells));
+    const std::vector<Color>& table = table_.Get(
+        steps, [&](float t) { return Interpolate(gradient_, t); });
+
+    // Project every pixel to get its index in the table. Along a row, it
+    // increases by a constant step.
+    const float scale = float(steps);
+    const float step = dX * scale;
+    const int y_min = std::max(box_.y_min, screen.stencil.y_min);
+    const int y_max = std::min(box_.y_max, screen.stencil.y_max);
+    for (int y = y_min; y <= y_max; ++y) {
+      const PixelSpan span = screen.RowSpan(y, box_.x_min, box_.x_max);
+      const float start =
+          (float(span.x) * dX + float(y) * dY + dZ) * scale + 0.5f;
+      for (int i = 0; i < span.size; ++i) {
+        const int index = std::clamp(int(start + float(i) * step), 0, steps);
+        span.data[i].*field = table[size_t(index)];
       }
     }
 
     NodeDecorator::Render(screen);
   }
 
+  bool Hash(size_t* hash) override {
+    HashValue(hash, gradient_.angle);
+    for (const Color& color : gradient_.colors) {
+      HashValue(hash, color);
+    }
+    for (const float position : gradient_.positions) {
+      HashValue(hash, position);
+    }
+    HashValue(hash, background_color_);
+    return HashChildren(hash);
+  }
+
   LinearGradientNormalized gradient_;
   bool background_color_;
+  ColorTable table_;
 };
 
 }  // namespace
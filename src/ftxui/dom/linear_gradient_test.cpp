@@ -84,6 +84,30 @@ TEST(ColorTest, GradientBackground) {
   EXPECT_EQ(screen.PixelAt(4, 0).background_color, gradient_end);
 }
 
+TEST(ColorTest, GradientEveryPixel) {
+  // Axis aligned gradients have every pixel colored exactly.
+  for (const int width : {2, 7, 100, 300}) {
+    auto element =
+        text("") | flex | bgcolor(LinearGradient(Color::Red, Color::Blue));
+    Screen screen(width, 2);
+    Render(screen, element);
+    for (int x = 0; x < width; ++x) {
+      const Color expected = Color::Interpolate(
+          float(x) / float(width - 1), Color::Red, Color::Blue);
+      EXPECT_EQ(screen.PixelAt(x, 0).background_color, expected);
+      EXPECT_EQ(screen.PixelAt(x, 1).background_color, expected);
+    }
+  }
+}
+
+TEST(ColorTest, GradientSinglePixel) {
+  auto element = text("a") | color(LinearGradient(Color::Red, Color::Blue));
+  Screen screen(1, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color,
+            Color::Interpolate(0.5f, Color::Blue, Color::Blue));
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
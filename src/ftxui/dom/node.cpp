@@ -1,8 +1,11 @@
 #include <ftxui/screen/box.hpp>  // for Box
+#include <typeinfo>              // for type_info
 #include <utility>               // for move
 
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/hash.hpp"          // for HashCombine, HashValue
 #include "ftxui/dom/node.hpp"
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/screen.hpp"     // for Screen
 
 namespace ftxui {
 
@@ -25,13 +28,50 @@ void Node::SetBox(Box box) {
 }
 
 /// @brief Display an element on a ftxui::Screen.
+/// Children outside of the screen's stencil are skipped.
 /// @ingroup dom
 void Node::Render(Screen& screen) {
   for (auto& child : children_) {
-    child->Render(screen);
+    if (IsVisible(*child, screen)) {
+      child->Render(screen);
+    }
   }
 }
 
+/// @brief Return the area fully overwritten when drawing this element. By
+/// default, this is the biggest opaque area of its children.
+/// @ingroup dom
+Box Node::OpaqueBox() {
+  Box opaque{0, -1, 0, -1};
+  int opaque_area = 0;
+  for (auto& child : children_) {
+    const Box box = child->OpaqueBox();
+    if (box.IsEmpty()) {
+      continue;
+    }
+    if (box == box_) {
+      return box;
+    }
+    const int area = (box.x_max - box.x_min + 1) * (box.y_max - box.y_min + 1);
+    if (area > opaque_area) {
+      opaque = box;
+      opaque_area = area;
+    }
+  }
+  return opaque;
+}
+
+/// @brief Record the drawing of an element into a display list.
+/// @ingroup dom
+void Node::Compile(DisplayList& list) {
+  list.Draw(this);
+}
+
+// static
+bool Node::IsVisible(const Node& child, const Screen& screen) {
+  return !Box::Intersection(child.box_, screen.stencil).IsEmpty();
+}
+
 void Node::Check(Status* status) {
   for (auto& child : children_) {
     child->Check(status);
@@ -39,21 +79,35 @@ void Node::Check(Status* status) {
   status->need_iteration |= (status->iteration == 0);
 }
 
+/// @brief Combine the content of an element into |hash|. Elements are not
+/// hashable by default.
+/// @ingroup dom
+bool Node::Hash(size_t* /*hash*/) {
+  return false;
+}
+
+bool Node::HashChildren(size_t* hash) {
+  HashCombine(hash, typeid(*this).hash_code());
+  HashValue(hash, requirement_);
+  HashValue(hash, children_.size());
+  for (auto& child : children_) {
+    if (!child->Hash(hash)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /// @brief Display an element on a ftxui::Screen.
 /// @ingroup dom
 void Render(Screen& screen, const Element& element) {
   Render(screen, element.get());
 }
 
-/// @brief Display an element on a ftxui::Screen.
+/// @brief Run the layout algorithm, so that |node| fits |box|. It iterates
+/// until the elements stop asking for another iteration, up to 20 times.
 /// @ingroup dom
-void Render(Screen& screen, Node* node) {
-  Box box;
-  box.x_min = 0;
-  box.y_min = 0;
-  box.x_max = screen.dimx() - 1;
-  box.y_max = screen.dimy() - 1;
-
+void Layout(Node* node, Box box) {
   Node::Status status;
   node->Check(&status);
   const int max_iterations = 20;
@@ -69,6 +123,18 @@ void Render(Screen& screen, Node* node) {
     status.iteration++;
     node->Check(&status);
   }
+}
+
+/// @brief Display an element on a ftxui::Screen.
+/// @ingroup dom
+void Render(Screen& screen, Node* node) {
+  Box box;
+  box.x_min = 0;
+  box.y_min = 0;
+  box.x_max = screen.dimx() - 1;
+  box.y_max = screen.dimy() - 1;
+
+  Layout(node, box);
 
   // Step 3: Draw the element.
   screen.stencil = box;
@@ -78,6 +144,24 @@ void Render(Screen& screen, Node* node) {
   screen.ApplyShader();
 }
 
+/// @brief Layout an element to fit a ftxui::Screen, and record its drawing.
+/// The result can be drawn, possibly many times, using Render().
+/// @ingroup dom
+DisplayList Compile(Screen& screen, Element element) {
+  Box box;
+  box.x_min = 0;
+  box.y_min = 0;
+  box.x_max = screen.dimx() - 1;
+  box.y_max = screen.dimy() - 1;
+
+  Layout(element.get(), box);
+
+  DisplayList list;
+  element->Compile(list);
+  list.root_ = std::move(element);
+  return list;
+}
+
 }  // namespace ftxui
 
 // Copyright 2020 Arthur Sonzogni. All rights reserved.
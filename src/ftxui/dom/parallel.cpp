@@ -0,0 +1,395 @@
+#include <algorithm>           // for find, min
+#include <atomic>              // for atomic
+#include <condition_variable>  // for condition_variable
+#include <cstddef>             // for size_t
+#include <cstdint>             // for uint8_t
+#include <deque>               // for deque
+#include <functional>          // for function
+#include <memory>              // for make_shared, unique_ptr, make_unique
+#include <mutex>               // for mutex, lock_guard, unique_lock
+#include <string>              // for string
+#include <thread>              // for thread
+#include <utility>             // for move, swap
+#include <vector>              // for vector
+
+#include "ftxui/dom/effects.hpp"      // for EffectsRecorder
+#include "ftxui/dom/elements.hpp"     // for Element, parallel
+#include "ftxui/dom/node.hpp"         // for Node, Elements
+#include "ftxui/dom/parallel.hpp"
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen, Pixel
+#include "ftxui/util/autoreset.hpp"   // for AutoReset
+
+namespace ftxui {
+
+namespace {
+
+// The minimum number of cells for an element to be processed concurrently.
+// Below, the cost of handing it to another thread isn't worth it.
+constexpr int kMinArea = 512;
+
+// The maximum number of threads in the pool, in addition to the callers.
+constexpr unsigned kMaxThreads = 7;
+
+// The maximum number of tasks used to compute the requirement of the children
+// of a container.
+constexpr size_t kMaxChunks = 32;
+
+// Whether the calling thread processes the content of a ftxui::parallel
+// element.
+thread_local bool g_enabled = false;  // NOLINT
+
+int Area(const Box& box) {
+  return (box.x_max - box.x_min + 1) * (box.y_max - box.y_min + 1);
+}
+
+// A small work-stealing thread pool. Every thread owns a queue of tasks. It
+// runs its own tasks first, most recent first, and steals the oldest tasks of
+// the others when it has none left.
+class Pool {
+ public:
+  static Pool& Get() {
+    static Pool pool;
+    return pool;
+  }
+
+  // Call |task(i)| for every i in [0, count), and return once they are all
+  // done. The calling thread takes part.
+  void For(size_t count, const std::function<void(size_t)>& task) {
+    if (threads_.empty() || count <= 1) {
+      for (size_t i = 0; i < count; ++i) {
+        task(i);
+      }
+      return;
+    }
+
+    struct {
+      std::mutex mutex;
+      std::condition_variable done;
+      size_t remaining;
+    } join;
+    join.remaining = count;
+
+    // Count the tasks before queuing them: a worker may run one, and decrement
+    // the count, as soon as it is queued.
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      pending_ += count;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      Queue& queue = *queues_[i % queues_.size()];
+      const std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.tasks.emplace_back([&task, &join, i] {
+        task(i);
+        const std::lock_guard<std::mutex> join_lock(join.mutex);
+        if (--join.remaining == 0) {
+          join.done.notify_all();
+        }
+      });
+    }
+    wake_.notify_all();
+
+    // Help the workers, instead of only waiting for them.
+    while (RunOne(queues_.size())) {
+    }
+
+    std::unique_lock<std::mutex> lock(join.mutex);
+    join.done.wait(lock, [&] { return join.remaining == 0; });
+  }
+
+  size_t threads() const { return threads_.size(); }
+
+  Pool(const Pool&) = delete;
+  Pool(Pool&&) = delete;
+  Pool& operator=(const Pool&) = delete;
+  Pool& operator=(Pool&&) = delete;
+
+ private:
+  Pool() {
+#if !defined(__EMSCRIPTEN__)
+    const unsigned cores = std::thread::hardware_concurrency();
+    const unsigned count = std::min(kMaxThreads, cores > 1 ? cores - 1 : 0);
+    for (unsigned i = 0; i < count; ++i) {
+      queues_.push_back(std::make_unique<Queue>());
+    }
+    for (unsigned i = 0; i < count; ++i) {
+      threads_.emplace_back(&Pool::Work, this, size_t(i));
+    }
+#endif
+  }
+
+  ~Pool() {
+    {
+      const std::lock_guard<std::mutex> lock(mutex_);
+      quit_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  void Work(size_t index) {
+    while (true) {
+      if (RunOne(index)) {
+        continue;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      wake_.wait(lock, [&] { return quit_ || pending_ > 0; });
+      if (quit_) {
+        return;
+      }
+    }
+  }
+
+  // Run a single task, from the queue |own| if any, or stolen from another
+  // queue. Return false when there are none.
+  bool RunOne(size_t own) {
+    std::function<void()> task;
+    for (size_t i = 0; i < queues_.size() && !task; ++i) {
+      const size_t index = (own + i) % queues_.size();
+      Queue& queue = *queues_[index];
+      const std::lock_guard<std::mutex> lock(queue.mutex);
+      if (queue.tasks.empty()) {
+        continue;
+      }
+      if (index == own) {
+        task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+      } else {
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+      }
+    }
+    if (!task) {
+      return false;
+    }
+    --pending_;
+    task();
+    return true;
+  }
+
+  struct Queue {
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+  std::vector<std::unique_ptr<Queue>> queues_;
+  std::vector<std::thread> threads_;
+
+  // Wake up the workers when there are tasks.
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::atomic<size_t> pending_ = 0;
+  bool quit_ = false;
+};
+
+// A screen drawing an area of another screen, from another thread. The pixels
+// of the area are moved into this screen, and moved back once drawn, so that
+// threads never share them.
+class AreaScreen : public Screen {
+ public:
+  AreaScreen(Screen& screen, Box area)
+      : Screen(0, 0), screen_(screen), area_(area) {
+    dimx_ = screen.dimx();
+    dimy_ = screen.dimy();
+    stencil = area;
+    cursor_ = screen.cursor();
+    initial_cursor_ = cursor_;
+
+    // Keep the hyperlinks of the pixels moved in. The registered ones are
+    // never empty.
+    for (int id = 1; id <= 255 && !screen.Hyperlink(uint8_t(id)).empty();
+         ++id) {
+      hyperlinks_.push_back(screen.Hyperlink(uint8_t(id)));
+    }
+    hyperlinks_size_ = hyperlinks_.size();
+
+    pixels_.resize(dimy_);
+    for (int y = area.y_min; y <= area.y_max; ++y) {
+      pixels_[y].resize(area.x_max + 1);
+    }
+    Swap();
+  }
+
+  // Move the pixels back into the original screen. This may be called from
+  // any thread.
+  void Restore() { Swap(); }
+
+  // Forward the hyperlinks and the cursor to the original screen. This must
+  // be called from the thread drawing the original screen.
+  void Merge() {
+    if (hyperlinks_.size() > hyperlinks_size_) {
+      for (int y = area_.y_min; y <= area_.y_max; ++y) {
+        for (int x = area_.x_min; x <= area_.x_max; ++x) {
+          Pixel& pixel = screen_.PixelAt(x, y);
+          if (pixel.hyperlink >= hyperlinks_size_) {
+            pixel.hyperlink =
+                screen_.RegisterHyperlink(hyperlinks_[pixel.hyperlink]);
+          }
+        }
+      }
+    }
+
+    if (cursor_.x != initial_cursor_.x || cursor_.y != initial_cursor_.y ||
+        cursor_.shape != initial_cursor_.shape) {
+      screen_.SetCursor(cursor_);
+    }
+  }
+
+ private:
+  void Swap() {
+    for (int y = area_.y_min; y <= area_.y_max; ++y) {
+      for (int x = area_.x_min; x <= area_.x_max; ++x) {
+        std::swap(pixels_[y][x], screen_.PixelAt(x, y));
+      }
+    }
+  }
+
+  Screen& screen_;
+  Box area_;
+  Cursor initial_cursor_;
+  size_t hyperlinks_size_;
+};
+
+class Parallel : public Node {
+ public:
+  explicit Parallel(Element child) : Node(unpack(std::move(child))) {}
+
+  void ComputeRequirement() override {
+    const AutoReset<bool> enabled(&g_enabled, true);
+    Node::ComputeRequirement();
+    requirement_ = children_[0]->requirement();
+  }
+
+  void SetBox(Box box) override {
+    const AutoReset<bool> enabled(&g_enabled, true);
+    Node::SetBox(box);
+    children_[0]->SetBox(box);
+  }
+
+  void Render(Screen& screen) override {
+    EffectsRecorder::OnUntracked();
+    const AutoReset<bool> enabled(&g_enabled, true);
+    Node::Render(screen);
+  }
+
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
+};
+
+}  // namespace
+
+namespace parallel_helper {
+
+bool Enabled() {
+  // Without other threads, the children are processed the usual way.
+  return g_enabled && Pool::Get().threads() != 0;
+}
+
+void ComputeRequirement(const Elements& elements) {
+  // The elements are handed to the threads by contiguous chunks, so that many
+  // small elements don't cost a task each.
+  const size_t chunks = std::min(elements.size(), kMaxChunks);
+  Pool::Get().For(chunks, [&](size_t chunk) {
+    const AutoReset<bool> enabled(&g_enabled, false);
+    const size_t begin = elements.size() * chunk / chunks;
+    const size_t end = elements.size() * (chunk + 1) / chunks;
+    for (size_t i = begin; i < end; ++i) {
+      elements[i]->ComputeRequirement();
+    }
+  });
+}
+
+void SetBox(const Elements& elements, const std::vector<Box>& boxes) {
+  std::vector<size_t> large;
+  for (size_t i = 0; i < elements.size(); ++i) {
+    if (Area(boxes[i]) >= kMinArea) {
+      large.push_back(i);
+    } else {
+      elements[i]->SetBox(boxes[i]);
+    }
+  }
+  Pool::Get().For(large.size(), [&](size_t i) {
+    const AutoReset<bool> enabled(&g_enabled, false);
+    elements[large[i]]->SetBox(boxes[large[i]]);
+  });
+}
+
+void Render(Screen& screen, const Elements& elements) {
+  std::vector<Node*> large;
+  std::vector<Box> areas;
+  for (const auto& element : elements) {
+    const Box area = Box::Intersection(element->box(), screen.stencil);
+    if (!area.IsEmpty() && Area(area) >= kMinArea) {
+      large.push_back(element.get());
+      areas.push_back(area);
+    }
+  }
+
+  if (large.size() >= 2) {
+    std::vector<std::unique_ptr<AreaScreen>> screens(large.size());
+    Pool::Get().For(large.size(), [&](size_t i) {
+      const AutoReset<bool> enabled(&g_enabled, false);
+      screens[i] = std::make_unique<AreaScreen>(screen, areas[i]);
+      large[i]->Render(*screens[i]);
+      screens[i]->Restore();
+    });
+    for (auto& area_screen : screens) {
+      area_screen->Merge();
+    }
+  } else {
+    large.clear();
+  }
+
+  // Draw the remaining elements from this thread.
+  for (const auto& element : elements) {
+    if (std::find(large.begin(), large.end(), element.get()) != large.end()) {
+      continue;
+    }
+    if (!Box::Intersection(element->box(), screen.stencil).IsEmpty()) {
+      element->Render(screen);
+    }
+  }
+}
+
+}  // namespace parallel_helper
+
+/// @brief Lay out and draw the children of the containers inside |child|
+/// concurrently, using a small pool of threads. Only the large children are
+/// handed to other threads.
+///
+/// This is useful for documents made of large independent panels. Each panel
+/// must draw only inside its own box. On single core machines, this does
+/// nothing.
+///
+/// The panels are processed at the same time, so the state they modify must
+/// not be shared: the callbacks and the data given to their elements (e.g.
+/// `canvas` functions, `ConstRef` values, `reflect` boxes) must be distinct
+/// from one panel to another. The state owned by the library is handled:
+/// - Each thread draws into its own copy of the pixels of its panel, with its
+///   own hyperlinks and cursor, merged back into the screen afterward.
+/// - The Reconciler is only used from the calling thread. The `key` elements
+///   drawn by other threads are always drawn again, and the keyed elements
+///   and the cached windows enclosing a parallel element are never reused.
+/// - The other global state, like Terminal::ColorSupport(), is only read. It
+///   must not be modified while drawing.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = hbox({
+///   panel_a,
+///   separator(),
+///   panel_b,
+/// }) | parallel;
+/// ```
+Element parallel(Element child) {
+  return std::make_shared<Parallel>(std::move(child));
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,39 @@
+#ifndef FTXUI_DOM_PARALLEL_HPP
+#define FTXUI_DOM_PARALLEL_HPP
+
+#include <vector>  // for vector
+
+#include "ftxui/dom/node.hpp"    // for Elements
+#include "ftxui/screen/box.hpp"  // for Box
+
+namespace ftxui {
+class Screen;
+
+// Process the children of containers concurrently, inside a
+// ftxui::parallel element. See ftxui::parallel.
+namespace parallel_helper {
+
+// Whether the calling thread processes the content of a ftxui::parallel
+// element. Containers must then use the functions below to process their
+// children.
+bool Enabled();
+
+// Call ComputeRequirement() of every element, concurrently.
+void ComputeRequirement(const Elements& elements);
+
+// Call SetBox(boxes[i]) of every element. The large ones are laid out
+// concurrently.
+void SetBox(const Elements& elements, const std::vector<Box>& boxes);
+
+// Draw the visible elements. The large ones are drawn concurrently, each into
+// its own area of |screen|. The elements must not overlap.
+void Render(Screen& screen, const Elements& elements);
+
+}  // namespace parallel_helper
+}  // namespace ftxui
+
+#endif  // FTXUI_DOM_PARALLEL_HPP
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
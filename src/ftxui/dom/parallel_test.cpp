@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <string>         // for allocator, to_string, string
+
+#include "ftxui/dom/elements.hpp"    // for text, hbox, vbox, border, separator, parallel, hyperlink, focusCursorBar, frame, operator|, Element
+#include "ftxui/dom/node.hpp"        // for Render
+#include "ftxui/dom/reconciler.hpp"  // for Reconciler, key
+#include "ftxui/screen/color.hpp"    // for Color
+#include "ftxui/screen/screen.hpp"   // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+Element Panel(int index) {
+  Elements lines;
+  for (int i = 0; i < 40; ++i) {
+    auto line = text("panel " + std::to_string(index) + " line " +
+                     std::to_string(i));
+    if (i % 3 == 0) {
+      line |= color(Color::Palette256(16 + index * 10 + i));
+    }
+    if (i == 7) {
+      line |= hyperlink("https://example.com/" + std::to_string(index));
+    }
+    if (index == 1 && i == 20) {
+      line |= focusCursorBar;
+    }
+    lines.push_back(line);
+  }
+  return vbox(std::move(lines)) | border;
+}
+
+Element Document() {
+  return hbox({
+      Panel(0) | flex,
+      separator(),
+      Panel(1) | frame | flex,
+      separator(),
+      Panel(2) | flex,
+  });
+}
+
+void ExpectSameScreen(const Screen& a, const Screen& b) {
+  EXPECT_EQ(a.ToString(), b.ToString());
+  EXPECT_EQ(a.cursor().x, b.cursor().x);
+  EXPECT_EQ(a.cursor().y, b.cursor().y);
+  for (int y = 0; y < a.dimy(); ++y) {
+    for (int x = 0; x < a.dimx(); ++x) {
+      EXPECT_EQ(a.Hyperlink(a.PixelAt(x, y).hyperlink),
+                b.Hyperlink(b.PixelAt(x, y).hyperlink));
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ParallelTest, SameAsSerial) {
+  Screen expected(100, 30);
+  Render(expected, Document());
+
+  Screen screen(100, 30);
+  Render(screen, Document() | parallel);
+  ExpectSameScreen(screen, expected);
+  EXPECT_EQ(screen.cursor().shape, Screen::Cursor::Bar);
+}
+
+TEST(ParallelTest, Nested) {
+  auto document = [] {
+    return vbox({
+        Document(),
+        separator(),
+        Document(),
+    });
+  };
+
+  Screen expected(120, 50);
+  Render(expected, document());
+
+  Screen screen(120, 50);
+  Render(screen, document() | parallel);
+  ExpectSameScreen(screen, expected);
+}
+
+TEST(ParallelTest, Reconciler) {
+  // The panels may be drawn by other threads, which don't use the reconciler.
+  auto document = [] {
+    return hbox({
+               Panel(0) | key("0") | flex,
+               separator(),
+               Panel(1) | key("1") | flex,
+           }) |
+           parallel | key("document");
+  };
+
+  Screen expected(100, 30);
+  Render(expected, document());
+
+  Reconciler reconciler;
+  for (int frame = 0; frame < 3; ++frame) {
+    Screen screen(100, 30);
+    reconciler.Render(screen, document());
+    ExpectSameScreen(screen, expected);
+    // The drawing of the element enclosing the parallel one is never reused.
+    EXPECT_LE(reconciler.reused(), 2);
+  }
+}
+
+TEST(ParallelTest, SmallChildren) {
+  // Below the threshold, the children are drawn from the calling thread.
+  auto document = [] {
+    return hbox({text("a"), separator(), text("b")}) | border;
+  };
+
+  Screen expected(10, 3);
+  Render(expected, document());
+
+  Screen screen(10, 3);
+  Render(screen, document() | parallel);
+  ExpectSameScreen(screen, expected);
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,231 @@
+#include <algorithm>  // for min, equal
+#include <memory>     // for make_shared
+#include <string>     // for string
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/effects.hpp"         // for Effects, EffectsRecorder
+#include "ftxui/dom/elements.hpp"        // for Decorator, Element
+#include "ftxui/dom/node.hpp"            // for Node, Render
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/dom/reconciler.hpp"
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Pixel, PixelSpan, Screen
+#include "ftxui/util/autoreset.hpp"      // for AutoReset
+
+namespace ftxui {
+
+namespace {
+
+// The reconciler drawing the current frame, from this thread. The threads
+// drawing the content of parallel() elements don't have one.
+thread_local Reconciler* g_active_reconciler = nullptr;  // NOLINT
+
+std::vector<Pixel> Read(Screen& screen, const Box& box) {
+  std::vector<Pixel> pixels;
+  pixels.reserve(size_t((box.x_max - box.x_min + 1) *  //
+                        (box.y_max - box.y_min + 1)));
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    const PixelSpan span = screen.RowSpan(y, box.x_min, box.x_max);
+    pixels.insert(pixels.end(), span.begin(), span.end());
+  }
+  return pixels;
+}
+
+bool Equal(Screen& screen, const Box& box, const std::vector<Pixel>& pixels) {
+  auto pixel = pixels.begin();
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    const PixelSpan span = screen.RowSpan(y, box.x_min, box.x_max);
+    if (!std::equal(span.begin(), span.end(), pixel)) {
+      return false;
+    }
+    pixel += span.size;
+  }
+  return true;
+}
+
+void Write(Screen& screen, const Box& box, const std::vector<Pixel>& pixels) {
+  const int width = box.x_max - box.x_min + 1;
+  const Pixel* pixel = pixels.data();
+  for (int y = box.y_min; y <= box.y_max; ++y) {
+    screen.BlitRow(box.x_min, y, pixel, width);
+    pixel += width;
+  }
+}
+
+bool HasHyperlink(const std::vector<Pixel>& pixels) {
+  for (const Pixel& pixel : pixels) {
+    if (pixel.hyperlink) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+class Reconciler::Keyed : public NodeDecorator {
+ public:
+  Keyed(Element child, std::string key)
+      : NodeDecorator(std::move(child)), key_(std::move(key)) {}
+
+  void Render(Screen& screen) override {
+    Reconciler* reconciler = g_active_reconciler;
+    if (!reconciler) {
+      Node::Render(screen);
+      return;
+    }
+
+    for (Entry* parent : reconciler->recording_) {
+      parent->keys.push_back(key_);
+    }
+    Entry& entry = reconciler->entries_[key_];
+    const bool duplicate = entry.generation == reconciler->generation_;
+    entry.generation = reconciler->generation_;
+
+    // Only the elements fully visible, with a unique key and a known content
+    // can be reused.
+    size_t hash = 0;
+    if (duplicate || box_.IsEmpty() ||
+        Box::Intersection(box_, screen.stencil) != box_ ||
+        !children_[0]->Hash(&hash)) {
+      entry.valid = false;
+      Node::Render(screen);
+      return;
+    }
+
+    if (entry.valid && entry.hash == hash && entry.box == box_ &&
+        Equal(screen, box_, entry.below)) {
+      Write(screen, box_, entry.drawn);
+      entry.effects.Replay(screen, 0, 0);
+      for (const std::string& key : entry.keys) {
+        reconciler->Seen(key);
+      }
+      reconciler->reused_++;
+      return;
+    }
+
+    entry.below = Read(screen, box_);
+    entry.keys.clear();
+    {
+      const EffectsRecorder recorder(screen, &entry.effects);
+      reconciler->recording_.push_back(&entry);
+      Node::Render(screen);
+      reconciler->recording_.pop_back();
+    }
+
+    entry.hash = hash;
+    entry.box = box_;
+    entry.drawn = Read(screen, box_);
+    // Hyperlinks are identified by ids only valid for the current frame.
+    entry.valid = entry.effects.complete && !HasHyperlink(entry.drawn);
+  }
+
+  bool Hash(size_t* hash) override { return HashChildren(hash); }
+
+ private:
+  std::string key_;
+};
+
+void Reconciler::Seen(const std::string& key) {
+  for (Entry* parent : recording_) {
+    parent->keys.push_back(key);
+  }
+  auto it = entries_.find(key);
+  if (it != entries_.end()) {
+    it->second.generation = generation_;
+  }
+}
+
+/// @brief Layout and draw |element| on |screen|, reusing the drawing of the
+/// keyed elements unchanged since the previous call.
+/// @ingroup dom
+void Reconciler::Render(Screen& screen, const Element& element) {
+  generation_++;
+  reused_ = 0;
+  {
+    const AutoReset<Reconciler*> active(&g_active_reconciler, this);
+    ftxui::Render(screen, element.get());
+  }
+
+  // Forget about the elements absent from this frame.
+  for (auto it = entries_.begin(); it != entries_.end();) {
+    if (it->second.generation != generation_) {
+      it = entries_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  ComputeChanged(screen);
+}
+
+// Compare the screen with the previous frame. On every row, the area between
+// the first and the last modified pixels is reported. Consecutive rows with
+// the same area are merged.
+void Reconciler::ComputeChanged(const Screen& screen) {
+  changed_.clear();
+  const int dimx = screen.dimx();
+  const int dimy = screen.dimy();
+  const bool resized = dimx != previous_dimx_ || dimy != previous_dimy_;
+  if (resized) {
+    previous_dimx_ = dimx;
+    previous_dimy_ = dimy;
+    previous_.assign(size_t(dimx * dimy), Pixel());
+    if (dimx > 0 && dimy > 0) {
+      changed_.push_back(Box{0, dimx - 1, 0, dimy - 1});
+    }
+  }
+
+  for (int y = 0; y < dimy; ++y) {
+    Pixel* previous = previous_.data() + size_t(y * dimx);
+    int x_min = dimx;
+    int x_max = -1;
+    for (int x = 0; x < dimx; ++x) {
+      const Pixel& pixel = screen.PixelAt(x, y);
+      if (previous[x] == pixel) {
+        continue;
+      }
+      previous[x] = pixel;
+      x_min = std::min(x_min, x);
+      x_max = x;
+    }
+
+    if (resized || x_max < 0) {
+      continue;
+    }
+    if (!changed_.empty() && changed_.back().y_max == y - 1 &&
+        changed_.back().x_min == x_min && changed_.back().x_max == x_max) {
+      changed_.back().y_max = y;
+    } else {
+      changed_.push_back(Box{x_min, x_max, y, y});
+    }
+  }
+}
+
+/// @brief Identify an element across the frames drawn by a Reconciler. When
+/// its type, content, style, position and the pixels below it are unchanged,
+/// its previous drawing is reused.
+/// @param key A key, unique in the frame.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = vbox({
+///   text("Title"),
+///   LongList() | key("list"),
+/// });
+/// reconciler.Render(screen, document);
+/// ```
+Decorator key(std::string key) {
+  return [key = std::move(key)](Element child) -> Element {
+    return std::make_shared<Reconciler::Keyed>(std::move(child), key);
+  };
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <cstddef>        // for size_t
+#include <memory>         // for make_shared
+#include <string>         // for string
+
+#include "ftxui/dom/elements.hpp"    // for text, vbox, border, reflect, operator|, Element
+#include "ftxui/dom/node.hpp"        // for Node, Render
+#include "ftxui/dom/reconciler.hpp"  // for Reconciler, key
+#include "ftxui/screen/box.hpp"      // for Box
+#include "ftxui/screen/color.hpp"    // for Color, Color::Red, Color::Blue
+#include "ftxui/screen/screen.hpp"   // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// A text counting how many times it is drawn.
+class CountedText : public Node {
+ public:
+  CountedText(std::string text, int* count)
+      : text_(std::move(text)), count_(count) {}
+  void ComputeRequirement() override {
+    requirement_.min_x = int(text_.size());
+    requirement_.min_y = 1;
+  }
+  void Render(Screen& screen) override {
+    ++*count_;
+    for (size_t i = 0; i < text_.size(); ++i) {
+      screen.PixelAt(box_.x_min + int(i), box_.y_min).character = text_[i];
+    }
+  }
+  bool Hash(size_t* hash) override {
+    *hash += std::hash<std::string>()(text_);
+    return HashChildren(hash);
+  }
+
+ private:
+  std::string text_;
+  int* count_;
+};
+
+Element Counted(std::string text, int* count) {
+  return std::make_shared<CountedText>(std::move(text), count);
+}
+
+}  // namespace
+
+TEST(ReconcilerTest, ReuseUnchanged) {
+  int count = 0;
+  Reconciler reconciler;
+  Screen screen(10, 3);
+
+  auto document = [&](std::string title) {
+    return vbox({
+        text(title),
+        Counted("list", &count) | border | key("list"),
+    });
+  };
+
+  reconciler.Render(screen, document("a"));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(reconciler.reused(), 0);
+  ASSERT_EQ(reconciler.changed().size(), 1u);
+  EXPECT_EQ(reconciler.changed()[0], (Box{0, 9, 0, 2}));
+
+  // Nothing changed.
+  screen.Clear();
+  reconciler.Render(screen, document("a"));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(reconciler.reused(), 1);
+  EXPECT_EQ(reconciler.changed().size(), 0u);
+
+  // Only the title changed.
+  screen.Clear();
+  reconciler.Render(screen, document("b"));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(reconciler.reused(), 1);
+  ASSERT_EQ(reconciler.changed().size(), 1u);
+  EXPECT_EQ(reconciler.changed()[0], (Box{0, 0, 0, 0}));
+
+  Screen expected(10, 3);
+  Render(expected, document("b"));
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+TEST(ReconcilerTest, ContentChanged) {
+  int count = 0;
+  Reconciler reconciler;
+  Screen screen(10, 3);
+  reconciler.Render(screen, Counted("abc", &count) | key("a"));
+  screen.Clear();
+  reconciler.Render(screen, Counted("abd", &count) | key("a"));
+  EXPECT_EQ(count, 2);
+  EXPECT_EQ(reconciler.reused(), 0);
+  ASSERT_EQ(reconciler.changed().size(), 1u);
+  EXPECT_EQ(reconciler.changed()[0], (Box{2, 2, 0, 0}));
+}
+
+TEST(ReconcilerTest, StyleAppliedBelowChanged) {
+  int count = 0;
+  Reconciler reconciler;
+  Screen screen(10, 3);
+  reconciler.Render(screen,
+                    Counted("abc", &count) | key("a") | color(Color::Red));
+  screen.Clear();
+  auto document = Counted("abc", &count) | key("a") | color(Color::Blue);
+  reconciler.Render(screen, document);
+  EXPECT_EQ(count, 2);
+
+  Screen expected(10, 3);
+  Render(expected, document);
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+}
+
+TEST(ReconcilerTest, MovedAndDuplicated) {
+  int count = 0;
+  Reconciler reconciler;
+  Screen screen(10, 3);
+  reconciler.Render(screen, vbox({
+                                Counted("a", &count) | key("a"),
+                                Counted("b", &count) | key("b"),
+                            }));
+  EXPECT_EQ(count, 2);
+
+  // "a" moved, "b" is drawn at the same place.
+  screen.Clear();
+  reconciler.Render(screen, vbox({
+                                text("x"),
+                                Counted("b", &count) | key("b"),
+                                Counted("a", &count) | key("a"),
+                            }));
+  EXPECT_EQ(count, 3);
+  EXPECT_EQ(reconciler.reused(), 1);
+
+  // Duplicated keys are always drawn.
+  screen.Clear();
+  reconciler.Render(screen, vbox({
+                                Counted("a", &count) | key("a"),
+                                Counted("a", &count) | key("a"),
+                            }));
+  EXPECT_EQ(count, 5);
+}
+
+TEST(ReconcilerTest, Cursor) {
+  int count = 0;
+  Reconciler reconciler;
+  Screen screen(10, 3);
+  auto document = [&] {
+    return vbox({
+        text("a"),
+        Counted("b", &count) | focusCursorBar | key("b"),
+    });
+  };
+  reconciler.Render(screen, document());
+  screen.SetCursor(Screen::Cursor{0, 0, Screen::Cursor::Hidden});
+  screen.Clear();
+  reconciler.Render(screen, document());
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(screen.cursor().x, 0);
+  EXPECT_EQ(screen.cursor().y, 1);
+  EXPECT_EQ(screen.cursor().shape, Screen::Cursor::Bar);
+}
+
+TEST(ReconcilerTest, Reflect) {
+  Reconciler reconciler;
+  Screen screen(20, 3);
+  Box box;
+  auto document = [&] {
+    return vbox({
+        text("title"),
+        text("button") | reflect(box) | key("k"),
+    });
+  };
+  for (int frame = 0; frame < 3; ++frame) {
+    screen.Clear();
+    reconciler.Render(screen, document());
+    EXPECT_EQ(reconciler.reused(), frame == 0 ? 0 : 1);
+    EXPECT_EQ(box, (Box{0, 19, 1, 1}));
+  }
+}
+
+TEST(ReconcilerTest, NestedKeys) {
+  int count = 0;
+  Reconciler reconciler;
+  Screen screen(10, 3);
+  auto document = [&](std::string title) {
+    return vbox({
+               text(title),
+               Counted("inner", &count) | key("inner"),
+           }) |
+           key("outer");
+  };
+
+  reconciler.Render(screen, document("a"));
+  EXPECT_EQ(count, 1);
+
+  // "outer" is reused. "inner" is not visited, but is kept.
+  screen.Clear();
+  reconciler.Render(screen, document("a"));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(reconciler.reused(), 1);
+
+  // "outer" is drawn again, reusing "inner".
+  screen.Clear();
+  reconciler.Render(screen, document("b"));
+  EXPECT_EQ(count, 1);
+  EXPECT_EQ(reconciler.reused(), 1);
+}
+
+TEST(ReconcilerTest, WithoutReconciler) {
+  Screen screen(5, 1);
+  Render(screen, text("text") | key("a"));
+  EXPECT_EQ(screen.ToString(), "text ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
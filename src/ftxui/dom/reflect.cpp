@@ -2,7 +2,9 @@
 #include <utility>  // for move
 #include <vector>   // for __alloc_traits<>::value_type
 
+#include "ftxui/dom/effects.hpp"      // for EffectsRecorder
 #include "ftxui/dom/elements.hpp"     // for Element, unpack, Decorator, reflect
+#include "ftxui/dom/hash.hpp"         // for HashValue
 #include "ftxui/dom/node.hpp"         // for Node, Elements
 #include "ftxui/dom/requirement.hpp"  // for Requirement
 #include "ftxui/screen/box.hpp"       // for Box
@@ -22,16 +24,24 @@ class Reflect : public Node {
   }
 
   void SetBox(Box box) final {
-    reflected_box_ = box;
+    // Stays empty when the element is outside of the visible area, and isn't
+    // rendered.
+    reflected_box_ = Box{0, -1, 0, -1};
     Node::SetBox(box);
     children_[0]->SetBox(box);
   }
 
   void Render(Screen& screen) final {
-    reflected_box_ = Box::Intersection(screen.stencil, reflected_box_);
+    reflected_box_ = Box::Intersection(screen.stencil, box_);
+    EffectsRecorder::OnReflect(reflected_box_);
     return Node::Render(screen);
   }
 
+  bool Hash(size_t* hash) final {
+    HashValue(hash, &reflected_box_);
+    return HashChildren(hash);
+  }
+
  private:
   Box& reflected_box_;
 };
@@ -65,6 +65,8 @@ Element vscroll_indicator(Element child) {
         screen.PixelAt(x, y).character = c;
       }
     }
+
+    bool Hash(size_t* hash) override { return HashChildren(hash); }
   };
   return std::make_shared<Impl>(std::move(child));
 }
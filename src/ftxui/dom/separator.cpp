@@ -3,12 +3,15 @@
 #include <string>   // for basic_string, string
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"  // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
-#include "ftxui/dom/node.hpp"      // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/color.hpp"     // for Color
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Element, BorderStyle, LIGHT, separator, DOUBLE, EMPTY, HEAVY, separatorCharacter, separatorDouble, separatorEmpty, separatorHSelector, separatorHeavy, separatorLight, separatorStyled, separatorVSelector
+#include "ftxui/dom/hash.hpp"          // for HashValue
+#include "ftxui/dom/node.hpp"          // for Node
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/dom/style.hpp"         // for Style
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/color.hpp"      // for Color
+#include "ftxui/screen/screen.hpp"     // for Pixel, Screen
 
 namespace ftxui {
 
@@ -37,8 +40,9 @@ class Separator : public Node {
   }
 
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
         Pixel& pixel = screen.PixelAt(x, y);
         pixel.character = value_;
         pixel.automerge = true;
@@ -46,6 +50,16 @@ class Separator : public Node {
     }
   }
 
+  void Compile(DisplayList& list) override {
+    list.FillGlyph(box_, value_);
+    list.ApplyStyle(box_, Style::Set(Style::kAutomerge));
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, value_);
+    return HashChildren(hash);
+  }
+
   std::string value_;
 };
 
@@ -64,8 +78,9 @@ class SeparatorAuto : public Node {
 
     const std::string c = charsets[style_][int(is_line && !is_column)];
 
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
+    const Box box = Box::Intersection(box_, screen.stencil);
+    for (int y = box.y_min; y <= box.y_max; ++y) {
+      for (int x = box.x_min; x <= box.x_max; ++x) {
         Pixel& pixel = screen.PixelAt(x, y);
         pixel.character = c;
         pixel.automerge = true;
@@ -73,6 +88,18 @@ class SeparatorAuto : public Node {
     }
   }
 
+  void Compile(DisplayList& list) override {
+    const bool is_column = (box_.x_max == box_.x_min);
+    const bool is_line = (box_.y_min == box_.y_max);
+    list.FillGlyph(box_, charsets[style_][int(is_line && !is_column)]);
+    list.ApplyStyle(box_, Style::Set(Style::kAutomerge));
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, style_);
+    return HashChildren(hash);
+  }
+
   BorderStyle style_;
 };
 
@@ -83,11 +110,16 @@ class SeparatorWithPixel : public SeparatorAuto {
     pixel_.automerge = true;
   }
   void Render(Screen& screen) override {
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y) = pixel_;
-      }
-    }
+    screen.FillRect(box_, pixel_);
+  }
+
+  Box OpaqueBox() override { return box_; }
+
+  void Compile(DisplayList& list) override { list.FillRect(box_, pixel_); }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, pixel_);
+    return HashChildren(hash);
   }
 
  private:
@@ -485,6 +517,14 @@ Element separatorHSelector(float left,
       }
     }
 
+    bool Hash(size_t* hash) override {
+      HashValue(hash, left_);
+      HashValue(hash, right_);
+      HashValue(hash, unselected_color_);
+      HashValue(hash, selected_color_);
+      return HashChildren(hash);
+    }
+
     float left_;
     float right_;
     Color unselected_color_;
@@ -555,6 +595,14 @@ Element separatorVSelector(float up,
       }
     }
 
+    bool Hash(size_t* hash) override {
+      HashValue(hash, up_);
+      HashValue(hash, down_);
+      HashValue(hash, unselected_color_);
+      HashValue(hash, selected_color_);
+      return HashChildren(hash);
+    }
+
     float up_;
     float down_;
     Color unselected_color_;
@@ -3,10 +3,12 @@
 #include <utility>    // for move
 #include <vector>     // for __alloc_traits<>::value_type
 
-#include "ftxui/dom/elements.hpp"  // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
-#include "ftxui/dom/node.hpp"      // for Node, Elements
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Constraint, WidthOrHeight, EQUAL, GREATER_THAN, LESS_THAN, WIDTH, unpack, Decorator, Element, size
+#include "ftxui/dom/hash.hpp"          // for HashValue
+#include "ftxui/dom/node.hpp"          // for Node, Elements
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/screen/box.hpp"        // for Box
 
 namespace ftxui {
 
@@ -70,6 +72,19 @@ class Size : public Node {
     children_[0]->SetBox(box);
   }
 
+  void Compile(DisplayList& list) override {
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, direction_);
+    HashValue(hash, constraint_);
+    HashValue(hash, value_);
+    return HashChildren(hash);
+  }
+
  private:
   WidthOrHeight direction_;
   Constraint constraint_;
@@ -0,0 +1,92 @@
+#include <algorithm>  // for max, min, remove
+#include <cstddef>    // for size_t
+#include <string>     // for string
+
+#include "ftxui/dom/box_helper.hpp"    // for Element, Sums, Distribution
+#include "ftxui/dom/gauge_helper.hpp"  // for RenderHorizontal
+#include "ftxui/dom/static_box.hpp"
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+#include "ftxui/screen/string.hpp"  // for Utf8ToGlyphs
+
+namespace ftxui::Static {
+
+namespace {
+
+box_helper::Element LayoutElement(int min_size,
+                                  int flex_grow,
+                                  int flex_shrink) {
+  box_helper::Element element;
+  element.min_size = min_size;
+  element.flex_grow = flex_grow;
+  element.flex_shrink = flex_shrink;
+  return element;
+}
+
+}  // namespace
+
+Text::Text(const std::string& text) : glyphs_(Utf8ToGlyphs(text)) {
+  glyphs_.erase(std::remove(glyphs_.begin(), glyphs_.end(), "\n"),
+                glyphs_.end());
+}
+
+void Text::Render(Screen& screen, const Box& box) const {
+  const int y = box.y_min;
+  if (y < screen.stencil.y_min || y > screen.stencil.y_max) {
+    return;
+  }
+  const int x_min = std::max(box.x_min, screen.stencil.x_min);
+  const int x_max = std::min({box.x_max, screen.stencil.x_max,
+                              box.x_min + min_x() - 1});
+  for (int x = x_min; x <= x_max; ++x) {
+    screen.PixelAt(x, y).character = glyphs_[size_t(x - box.x_min)];
+  }
+}
+
+Gauge::Gauge(float progress) : progress_(progress) {
+  // This handle NAN correctly:
+  if (!(progress_ > 0.F)) {
+    progress_ = 0.F;
+  }
+  if (!(progress_ < 1.F)) {
+    progress_ = 1.F;
+  }
+}
+
+void Gauge::Render(Screen& screen, const Box& box) const {
+  gauge_helper::RenderHorizontal(screen, box.x_min, box.x_max, box.y_min,
+                                 progress_);
+}
+
+void Separator::Render(Screen& screen, const Box& box) {
+  const Box clipped = Box::Intersection(box, screen.stencil);
+  for (int y = clipped.y_min; y <= clipped.y_max; ++y) {
+    for (int x = clipped.x_min; x <= clipped.x_max; ++x) {
+      Pixel& pixel = screen.PixelAt(x, y);
+      pixel.character = "│";
+      pixel.automerge = true;
+    }
+  }
+}
+
+void Layout(const int* flex_grow,
+            const int* flex_shrink,
+            int* size,
+            size_t count,
+            int target_size) {
+  box_helper::Sums sums;
+  for (size_t i = 0; i < count; ++i) {
+    sums.Add(LayoutElement(size[i], flex_grow[i], flex_shrink[i]));
+  }
+  box_helper::Distribution distribution(sums, target_size);
+  for (size_t i = 0; i < count; ++i) {
+    size[i] = distribution.Next(
+        LayoutElement(size[i], flex_grow[i], flex_shrink[i]));
+  }
+}
+
+}  // namespace ftxui::Static
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <string>         // for allocator, string
+
+#include "ftxui/dom/elements.hpp"    // for text, gauge, separator, hbox, border, Element
+#include "ftxui/dom/node.hpp"        // for Render
+#include "ftxui/dom/static_box.hpp"  // for static_hbox, Text, Gauge, Separator
+#include "ftxui/screen/screen.hpp"   // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+std::string Draw(Element element, int width, int height) {
+  Screen screen(width, height);
+  Render(screen, element);
+  return screen.ToString();
+}
+
+}  // namespace
+
+TEST(StaticBoxTest, MatchesHBox) {
+  auto expected = hbox({
+      text("CPU "),
+      gauge(0.5f),
+      separator(),
+      text("MEM "),
+      gauge(0.25f),
+  });
+  auto element = static_hbox(Static::Text("CPU "),        //
+                             Static::Gauge(0.5f),         //
+                             Static::Separator(),         //
+                             Static::Text("MEM "),        //
+                             Static::Gauge(0.25f));
+  for (int width = 0; width < 30; ++width) {
+    EXPECT_EQ(Draw(element, width, 1), Draw(expected, width, 1));
+  }
+}
+
+TEST(StaticBoxTest, Nested) {
+  auto expected = hbox({
+      text("a"),
+      hbox({text("b"), separator(), text("c")}),
+      gauge(1.f / 3.f),
+  });
+  auto element = static_hbox(
+      Static::Text("a"),
+      Static::HBox(Static::Text("b"), Static::Separator(), Static::Text("c")),
+      Static::Gauge(1.f / 3.f));
+  EXPECT_EQ(Draw(element, 10, 1), Draw(expected, 10, 1));
+}
+
+TEST(StaticBoxTest, Leaf) {
+  // The static layout interoperates with the other elements.
+  auto element = vbox({
+                     text("title"),
+                     separator(),
+                     static_hbox(Static::Text("ok"), Static::Separator(),
+                                 Static::Text("ｆｕｌｌ")),
+                 }) |
+                 border;
+  EXPECT_EQ(Draw(element, 13, 5),
+            "╭───────────╮\r\n"
+            "│title      │\r\n"
+            "├──┬────────┤\r\n"
+            "│ok│ｆｕｌｌ│\r\n"
+            "╰──┴────────╯");
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,179 @@
+#include <memory>   // for make_shared, __shared_ptr_access
+#include <utility>  // for move
+
+#include "ftxui/dom/display_list.hpp"    // for DisplayList
+#include "ftxui/dom/elements.hpp"        // for Element, operator|
+#include "ftxui/dom/hash.hpp"            // for HashValue
+#include "ftxui/dom/node.hpp"            // for Node
+#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
+#include "ftxui/dom/style.hpp"           // for Style
+#include "ftxui/dom/styled.hpp"          // for Stylize
+#include "ftxui/screen/box.hpp"          // for Box
+#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+
+namespace ftxui {
+
+namespace {
+
+class Styled : public NodeDecorator {
+ public:
+  Styled(Element child, const Style& before, const Style& after)
+      : NodeDecorator(std::move(child)), before_(before), after_(after) {}
+
+  // Fuse |before| and |after|, applied around this node, into it.
+  bool Wrap(const Style& before, const Style& after) {
+    Style fused_before = before;
+    Style fused_after = after_;
+    if (!fused_before.Merge(before_) || !fused_after.Merge(after)) {
+      return false;
+    }
+    before_ = fused_before;
+    after_ = fused_after;
+    return true;
+  }
+
+  void Render(Screen& screen) override {
+    Apply(screen, before_);
+    Node::Render(screen);
+    Apply(screen, after_);
+  }
+
+  void Compile(DisplayList& list) override {
+    if (!before_.empty()) {
+      list.ApplyStyle(box_, before_);
+    }
+    for (auto& child : children_) {
+      child->Compile(list);
+    }
+    if (!after_.empty()) {
+      list.ApplyStyle(box_, after_);
+    }
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, before_);
+    HashValue(hash, after_);
+    return HashChildren(hash);
+  }
+
+ private:
+  void Apply(Screen& screen, const Style& style) {
+    if (style.empty()) {
+      return;
+    }
+    screen.ForEachPixel(box_, [&](Pixel& pixel) { style.Apply(pixel); });
+  }
+
+  Style before_;
+  Style after_;
+};
+
+}  // namespace
+
+/// @brief A style setting |attributes|.
+/// @ingroup dom
+Style Style::Set(uint16_t attributes) {
+  Style style;
+  style.set = attributes;
+  return style;
+}
+
+/// @brief A style toggling |attributes|.
+/// @ingroup dom
+Style Style::Toggle(uint16_t attributes) {
+  Style style;
+  style.toggle = attributes;
+  return style;
+}
+
+/// @brief A style setting the foreground color.
+/// @ingroup dom
+Style Style::Foreground(Color color) {
+  Style style;
+  style.set = kForegroundColor;
+  style.foreground_color = color;
+  return style;
+}
+
+/// @brief A style setting the background color.
+/// @ingroup dom
+Style Style::Background(Color color) {
+  Style style;
+  style.set = kBackgroundColor;
+  style.background_color = color;
+  return style;
+}
+
+/// @brief Combine |next|, applied after this style, into this style.
+/// Toggling an attribute previously set can't be expressed by a single style.
+/// In this case, false is returned, and this style is left unchanged.
+/// @ingroup dom
+bool Style::Merge(const Style& next) {
+  if (next.toggle & set) {
+    return false;
+  }
+  set |= next.set;
+  toggle = (toggle ^ next.toggle) & ~next.set;
+  if (next.set & kForegroundColor) {
+    foreground_color = next.foreground_color;
+  }
+  if (next.set & kBackgroundColor) {
+    background_color = next.background_color;
+  }
+  return true;
+}
+
+/// @brief Apply the style to a single pixel.
+/// @ingroup dom
+void Style::Apply(Pixel& pixel) const {
+  pixel.blink = (pixel.blink || (set & kBlink)) != bool(toggle & kBlink);
+  pixel.bold = (pixel.bold || (set & kBold)) != bool(toggle & kBold);
+  pixel.dim = (pixel.dim || (set & kDim)) != bool(toggle & kDim);
+  pixel.inverted =
+      (pixel.inverted || (set & kInverted)) != bool(toggle & kInverted);
+  pixel.underlined =
+      (pixel.underlined || (set & kUnderlined)) != bool(toggle & kUnderlined);
+  pixel.underlined_double =
+      (pixel.underlined_double || (set & kUnderlinedDouble)) !=
+      bool(toggle & kUnderlinedDouble);
+  pixel.strikethrough = (pixel.strikethrough || (set & kStrikethrough)) !=
+                        bool(toggle & kStrikethrough);
+  pixel.automerge =
+      (pixel.automerge || (set & kAutomerge)) != bool(toggle & kAutomerge);
+  if (set & kForegroundColor) {
+    pixel.foreground_color = foreground_color;
+  }
+  if (set & kBackgroundColor) {
+    pixel.background_color = background_color;
+  }
+}
+
+Element Stylize(Element child, const Style& before, const Style& after) {
+  auto* styled = dynamic_cast<Styled*>(child.get());
+  // The node can be modified in place only when nobody else refers to it.
+  if (styled && child.use_count() == 1 && styled->Wrap(before, after)) {
+    return child;
+  }
+  return std::make_shared<Styled>(std::move(child), before, after);
+}
+
+/// @brief Apply a Style to an element. Consecutive styles are fused and
+/// applied in a single pass.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = text("Hello")
+///                  | Style::Set(Style::kBold)
+///                  | Style::Foreground(Color::Red);
+/// ```
+Element operator|(Element element, const Style& style) {
+  return Stylize(std::move(element), style, {});
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, EXPECT_TRUE, EXPECT_FALSE, TEST
+
+#include "ftxui/dom/elements.hpp"   // for operator|, text, bold, dim, inverted, color, bgcolor, underlined, Element
+#include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/dom/style.hpp"      // for Style
+#include "ftxui/screen/color.hpp"   // for Color, Color::Red, Color::Blue
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(StyleTest, FuseDecorators) {
+  auto element = text("text") | bold | dim | color(Color::Red) |
+                 bgcolor(Color::Blue) | underlined;
+  // The decorators are fused into a single node.
+  EXPECT_EQ(element.use_count(), 1);
+  Screen screen(5, 1);
+  Render(screen, element);
+  const Pixel& pixel = screen.PixelAt(0, 0);
+  EXPECT_TRUE(pixel.bold);
+  EXPECT_TRUE(pixel.dim);
+  EXPECT_TRUE(pixel.underlined);
+  EXPECT_FALSE(pixel.inverted);
+  EXPECT_EQ(pixel.foreground_color, Color::Red);
+  EXPECT_EQ(pixel.background_color, Color::Blue);
+}
+
+TEST(StyleTest, InnerColorWins) {
+  auto element = text("text") | color(Color::Red) | color(Color::Blue);
+  Screen screen(5, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::Red);
+}
+
+TEST(StyleTest, InvertedTwice) {
+  auto element = text("text") | inverted | inverted;
+  Screen screen(5, 1);
+  Render(screen, element);
+  EXPECT_FALSE(screen.PixelAt(0, 0).inverted);
+}
+
+TEST(StyleTest, SetThenToggle) {
+  // Setting, then toggling an attribute can't be fused.
+  auto element = text("text") | Style::Toggle(Style::kInverted) |
+                 Style::Set(Style::kInverted);
+  Screen screen(5, 1);
+  Render(screen, element);
+  EXPECT_FALSE(screen.PixelAt(0, 0).inverted);
+}
+
+TEST(StyleTest, SharedChildIsNotModified) {
+  auto shared = text("text") | bold;
+  auto element = shared | dim;
+  Screen screen(5, 1);
+  Render(screen, shared);
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_FALSE(screen.PixelAt(0, 0).dim);
+
+  Render(screen, element);
+  EXPECT_TRUE(screen.PixelAt(0, 0).dim);
+}
+
+TEST(StyleTest, Value) {
+  auto element =
+      text("text") | Style::Set(Style::kBold | Style::kStrikethrough) |
+      Style::Foreground(Color::Red);
+  Screen screen(5, 1);
+  Render(screen, element);
+  EXPECT_TRUE(screen.PixelAt(0, 0).bold);
+  EXPECT_TRUE(screen.PixelAt(0, 0).strikethrough);
+  EXPECT_EQ(screen.PixelAt(0, 0).foreground_color, Color::Red);
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -0,0 +1,20 @@
+#ifndef FTXUI_DOM_STYLED_HPP
+#define FTXUI_DOM_STYLED_HPP
+
+#include "ftxui/dom/node.hpp"   // for Element
+#include "ftxui/dom/style.hpp"  // for Style
+
+namespace ftxui {
+
+// Apply |before| to the pixels of |child| before drawing it, and |after| once
+// it has been drawn. When |child| is itself the result of Stylize(), the two
+// are fused into a single node, applying every attribute in one pass.
+Element Stylize(Element child, const Style& before, const Style& after);
+
+}  // namespace ftxui
+
+#endif /* end of include guard: FTXUI_DOM_STYLED_HPP */
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
@@ -1,10 +1,18 @@
 #include "ftxui/dom/table.hpp"
 
-#include <algorithm>  // for max
-#include <memory>   // for allocator, shared_ptr, allocator_traits<>::value_type
-#include <utility>  // for move, swap
+#include <algorithm>  // for max, min, sort, upper_bound
+#include <cstdint>    // for int64_t
+#include <functional>  // for function
+#include <memory>  // for allocator, shared_ptr, allocator_traits<>::value_type
+#include <string>   // for string
+#include <utility>  // for move, swap, pair
+#include <vector>   // for vector
 
 #include "ftxui/dom/elements.hpp"  // for Element, operator|, text, separatorCharacter, Elements, BorderStyle, Decorator, emptyElement, size, gridbox, EQUAL, flex, flex_shrink, HEIGHT, WIDTH
+#include "ftxui/dom/node.hpp"       // for Node
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/screen/string.hpp"  // for string_width
 
 namespace ftxui {
 namespace {
@@ -36,8 +44,165 @@ void Order(int& a, int& b) {
   }
 }
 
+// Number of even integers in [a, b], with 0 <= a.
+int EvenCount(int a, int b) {
+  return std::max(0, b / 2 - (a + 1) / 2 + 1);
+}
+
+// Number of rows sampled to estimate the width of a column of a virtualized
+// table, when it wasn't declared.
+const int kColumnWidthSamples = 64;
+
 }  // namespace
 
+// A table whose cells are built on demand, only for the part intersecting the
+// visible area of the screen.
+class VirtualTable : public Node {
+ public:
+  explicit VirtualTable(Table table) : table_(std::move(table)) {
+    // Compute the position of every column.
+    column_offsets_.resize(table_.dim_x_ + 1, 0);
+    for (int x = 0; x < table_.dim_x_; ++x) {
+      column_offsets_[x + 1] = column_offsets_[x] + ColumnWidth(x);
+    }
+
+    // Merge the rows holding a separator into disjoint intervals.
+    auto rows = std::move(table_.separator_rows_);
+    std::sort(rows.begin(), rows.end());
+    for (auto [y_min, y_max] : rows) {
+      y_min = std::max(y_min, 0);
+      y_max = std::min(y_max, table_.dim_y_ - 1);
+      if (y_min > y_max) {
+        continue;
+      }
+      if (!separator_rows_.empty() &&
+          separator_rows_.back().second + 1 >= y_min) {
+        auto& last = separator_rows_.back().second;
+        last = std::max(last, y_max);
+        continue;
+      }
+      separator_rows_.emplace_back(y_min, y_max);
+    }
+    separator_rows_prefix_.resize(separator_rows_.size(), 0);
+    for (size_t i = 1; i < separator_rows_.size(); ++i) {
+      separator_rows_prefix_[i] =
+          separator_rows_prefix_[i - 1] +
+          EvenCount(separator_rows_[i - 1].first, separator_rows_[i - 1].second);
+    }
+  }
+
+  void ComputeRequirement() override {
+    requirement_.min_x = column_offsets_.back();
+    requirement_.min_y = RowOffset(table_.dim_y_);
+  }
+
+  void Render(Screen& screen) override {
+    const Box visible = Box::Intersection(box_, screen.stencil);
+    if (visible.x_min > visible.x_max || visible.y_min > visible.y_max ||
+        table_.dim_x_ <= 1 || table_.dim_y_ <= 1) {
+      return;
+    }
+
+    const int x_min = ColumnAt(visible.x_min - box_.x_min);
+    const int x_max = ColumnAt(visible.x_max - box_.x_min);
+    const int y_min = RowAt(visible.y_min - box_.y_min);
+    const int y_max = RowAt(visible.y_max - box_.y_min);
+    Table window = table_.Window(x_min, x_max, y_min, y_max);
+
+    Box box;
+    int top = RowOffset(y_min);
+    for (int y = y_min; y <= y_max; ++y) {
+      const int bottom = RowOffset(y + 1);
+      box.y_min = box_.y_min + top;
+      box.y_max = box_.y_min + bottom - 1;
+      top = bottom;
+      if (box.y_min > box.y_max) {
+        continue;
+      }
+      for (int x = x_min; x <= x_max; ++x) {
+        box.x_min = box_.x_min + column_offsets_[x];
+        box.x_max = box_.x_min + column_offsets_[x + 1] - 1;
+        if (box.x_min > box.x_max) {
+          continue;
+        }
+        Element& element = window.At(x, y);
+        element->ComputeRequirement();
+        element->SetBox(box);
+        element->Render(screen);
+      }
+    }
+  }
+
+ private:
+  int ColumnWidth(int x) const {
+    if (x % 2 == 0) {
+      return table_.separator_columns_[x] ? 1 : 0;
+    }
+
+    const int column = x / 2;
+    if (table_.column_widths_[column] >= 0) {
+      return table_.column_widths_[column];
+    }
+
+    // Estimate the width using a sample of evenly spaced rows.
+    const int rows = table_.input_dim_y_;
+    const int samples = std::min(rows, kColumnWidthSamples);
+    int width = 0;
+    for (int i = 0; i < samples; ++i) {
+      const int row =
+          samples == 1 ? 0 : int(int64_t(i) * (rows - 1) / (samples - 1));
+      width = std::max(width, string_width(table_.cell_(row, column)));
+    }
+    return width;
+  }
+
+  // The number of rows holding a separator in [0, y).
+  int SeparatorRowsBefore(int y) const {
+    const auto it = std::upper_bound(
+        separator_rows_.begin(), separator_rows_.end(), y - 1,
+        [](int value, const auto& range) { return value < range.first; });
+    if (it == separator_rows_.begin()) {
+      return 0;
+    }
+    const size_t i = it - separator_rows_.begin() - 1;
+    return separator_rows_prefix_[i] +
+           EvenCount(separator_rows_[i].first,
+                     std::min(separator_rows_[i].second, y - 1));
+  }
+
+  // The vertical position of the row |y|, relative to the top of the table.
+  int RowOffset(int y) const { return y / 2 + SeparatorRowsBefore(y); }
+
+  // The row drawn at the vertical position |offset|.
+  int RowAt(int offset) const {
+    int min = 0;
+    int max = table_.dim_y_ - 1;
+    while (min < max) {
+      const int middle = (min + max) / 2;
+      if (RowOffset(middle + 1) > offset) {
+        max = middle;
+      } else {
+        min = middle + 1;
+      }
+    }
+    return min;
+  }
+
+  // The column drawn at the horizontal position |offset|.
+  int ColumnAt(int offset) const {
+    const int x = int(std::upper_bound(column_offsets_.begin(),
+                                       column_offsets_.end(), offset) -
+                      column_offsets_.begin()) -
+                  1;
+    return std::max(0, std::min(x, table_.dim_x_ - 1));
+  }
+
+  Table table_;
+  std::vector<int> column_offsets_;
+  std::vector<std::pair<int, int>> separator_rows_;
+  std::vector<int> separator_rows_prefix_;
+};
+
 Table::Table() {
   Initialize({});
 }
@@ -60,6 +225,86 @@ Table::Table(std::vector<std::vector<Element>> input) {
   Initialize(std::move(input));
 }
 
+/// @brief Create a virtualized table. The cells are not stored, they are
+/// requested from |cell| when they become visible.
+/// @param rows The number of rows.
+/// @param columns The number of columns.
+/// @param cell A function returning the content of a cell.
+Table::Table(int rows,
+             int columns,
+             std::function<std::string(int row, int column)> cell)
+    : input_dim_x_(columns),
+      input_dim_y_(rows),
+      dim_x_(2 * columns + 1),
+      dim_y_(2 * rows + 1),
+      cell_(std::move(cell)),
+      column_widths_(columns, -1),
+      separator_columns_(dim_x_, false) {}
+
+/// @brief Fix the width of a column. For virtualized tables, this avoids
+/// sampling the cells to estimate it.
+/// @param column The index of the column.
+/// @param width The width of the column.
+void Table::SetColumnWidth(int column, int width) {
+  if (column < 0 || column >= input_dim_x_) {
+    return;
+  }
+
+  if (cell_) {
+    column_widths_[column] = width;
+    return;
+  }
+
+  for (int y = 1; y < int(elements_.size()); y += 2) {
+    Element& e = elements_[y][2 * column + 1];
+    e = std::move(e) | size(WIDTH, EQUAL, width);
+  }
+}
+
+bool Table::Contain(int x, int y) const {
+  return y >= origin_y_ && y - origin_y_ < int(elements_.size()) &&  //
+         x >= origin_x_ && x - origin_x_ < int(elements_[0].size());
+}
+
+Element& Table::At(int x, int y) {
+  return elements_[y - origin_y_][x - origin_x_];
+}
+
+// Materialize the [x_min, x_max]x[y_min, y_max] part of a virtualized table,
+// and apply the selections intersecting it.
+Table Table::Window(int x_min, int x_max, int y_min, int y_max) const {
+  Table window;
+  window.input_dim_x_ = input_dim_x_;
+  window.input_dim_y_ = input_dim_y_;
+  window.dim_x_ = dim_x_;
+  window.dim_y_ = dim_y_;
+  window.origin_x_ = x_min;
+  window.origin_y_ = y_min;
+  window.elements_.assign(y_max - y_min + 1, {});
+  for (int y = y_min; y <= y_max; ++y) {
+    auto& row = window.elements_[y - y_min];
+    row.reserve(x_max - x_min + 1);
+    for (int x = x_min; x <= x_max; ++x) {
+      row.push_back(IsCell(x, y) ? text(cell_(y / 2, x / 2)) : emptyElement());
+    }
+  }
+
+  for (const auto& deferred : deferred_) {
+    if (deferred.x_max < x_min || deferred.x_min > x_max ||
+        deferred.y_max < y_min || deferred.y_min > y_max) {
+      continue;
+    }
+    TableSelection selection;  // NOLINT
+    selection.table_ = &window;
+    selection.x_min_ = deferred.x_min;
+    selection.x_max_ = deferred.x_max;
+    selection.y_min_ = deferred.y_min;
+    selection.y_max_ = deferred.y_max;
+    deferred.apply(selection);
+  }
+  return window;
+}
+
 void Table::Initialize(std::vector<std::vector<Element>> input) {
   input_dim_y_ = input.size();
   input_dim_x_ = 0;
@@ -157,6 +402,10 @@ TableSelection Table::SelectAll() {
 }
 
 Element Table::Render() {
+  if (cell_) {
+    return std::make_shared<VirtualTable>(std::move(*this));
+  }
+
   for (int y = 0; y < dim_y_; ++y) {
     for (int x = 0; x < dim_x_; ++x) {
       auto& it = elements_[y][x];
@@ -182,11 +431,64 @@ Element Table::Render() {
   return gridbox(std::move(elements_));
 }
 
+bool TableSelection::Defer(std::function<void(TableSelection&)> apply) {
+  if (!table_->cell_) {
+    return false;
+  }
+  table_->deferred_.push_back(
+      {x_min_, x_max_, y_min_, y_max_, std::move(apply)});
+  return true;
+}
+
+// Record the columns where a virtualized table draws vertical separators.
+void TableSelection::MarkSeparatorColumns(int x_min, int x_max) {
+  if (!table_->cell_) {
+    return;
+  }
+  x_min = std::max(x_min, 0);
+  x_max = std::min(x_max, table_->dim_x_ - 1);
+  for (int x = x_min; x <= x_max; ++x) {
+    if (x % 2 == 0) {
+      table_->separator_columns_[x] = true;
+    }
+  }
+}
+
+// Record the rows where a virtualized table draws horizontal separators.
+void TableSelection::MarkSeparatorRows(int y_min, int y_max) {
+  if (!table_->cell_ || y_min > y_max) {
+    return;
+  }
+  table_->separator_rows_.emplace_back(y_min, y_max);
+}
+
+int TableSelection::XBegin(int x) const {
+  return std::max(x, table_->origin_x_);
+}
+
+int TableSelection::XEnd(int x) const {
+  if (table_->elements_.empty()) {
+    return table_->origin_x_ - 1;
+  }
+  return std::min(x, table_->origin_x_ + int(table_->elements_[0].size()) - 1);
+}
+
+int TableSelection::YBegin(int y) const {
+  return std::max(y, table_->origin_y_);
+}
+
+int TableSelection::YEnd(int y) const {
+  return std::min(y, table_->origin_y_ + int(table_->elements_.size()) - 1);
+}
+
 // NOLINTNEXTLINE
 void TableSelection::Decorate(Decorator decorator) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
-      Element& e = table_->elements_[y][x];
+  if (Defer([decorator](TableSelection& s) { s.Decorate(decorator); })) {
+    return;
+  }
+  for (int y = YBegin(y_min_); y <= YEnd(y_max_); ++y) {
+    for (int x = XBegin(x_min_); x <= XEnd(x_max_); ++x) {
+      Element& e = table_->At(x, y);
       e = std::move(e) | decorator;
     }
   }
@@ -194,10 +496,13 @@ void TableSelection::Decorate(Decorator decorator) {
 
 // NOLINTNEXTLINE
 void TableSelection::DecorateCells(Decorator decorator) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
+  if (Defer([decorator](TableSelection& s) { s.DecorateCells(decorator); })) {
+    return;
+  }
+  for (int y = YBegin(y_min_); y <= YEnd(y_max_); ++y) {
+    for (int x = XBegin(x_min_); x <= XEnd(x_max_); ++x) {
       if (y % 2 == 1 && x % 2 == 1) {
-        Element& e = table_->elements_[y][x];
+        Element& e = table_->At(x, y);
         e = std::move(e) | decorator;
       }
     }
@@ -208,10 +513,15 @@ void TableSelection::DecorateCells(Decorator decorator) {
 void TableSelection::DecorateAlternateColumn(Decorator decorator,
                                              int modulo,
                                              int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
+  if (Defer([=](TableSelection& s) {
+        s.DecorateAlternateColumn(decorator, modulo, shift);
+      })) {
+    return;
+  }
+  for (int y = YBegin(y_min_); y <= YEnd(y_max_); ++y) {
+    for (int x = XBegin(x_min_); x <= XEnd(x_max_); ++x) {
       if (y % 2 == 1 && (x / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
+        Element& e = table_->At(x, y);
         e = std::move(e) | decorator;
       }
     }
@@ -222,10 +532,15 @@ void TableSelection::DecorateAlternateColumn(Decorator decorator,
 void TableSelection::DecorateAlternateRow(Decorator decorator,
                                           int modulo,
                                           int shift) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
+  if (Defer([=](TableSelection& s) {
+        s.DecorateAlternateRow(decorator, modulo, shift);
+      })) {
+    return;
+  }
+  for (int y = YBegin(y_min_ + 1); y <= YEnd(y_max_ - 1); ++y) {
+    for (int x = XBegin(x_min_); x <= XEnd(x_max_); ++x) {
       if (y % 2 == 1 && (y / 2) % modulo == shift) {
-        Element& e = table_->elements_[y][x];
+        Element& e = table_->At(x, y);
         e = std::move(e) | decorator;
       }
     }
@@ -236,10 +551,15 @@ void TableSelection::DecorateAlternateRow(Decorator decorator,
 void TableSelection::DecorateCellsAlternateColumn(Decorator decorator,
                                                   int modulo,
                                                   int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
+  if (Defer([=](TableSelection& s) {
+        s.DecorateCellsAlternateColumn(decorator, modulo, shift);
+      })) {
+    return;
+  }
+  for (int y = YBegin(y_min_); y <= YEnd(y_max_); ++y) {
+    for (int x = XBegin(x_min_); x <= XEnd(x_max_); ++x) {
       if (y % 2 == 1 && x % 2 == 1 && ((x / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
+        Element& e = table_->At(x, y);
         e = std::move(e) | decorator;
       }
     }
@@ -250,10 +570,15 @@ void TableSelection::DecorateCellsAlternateColumn(Decorator decorator,
 void TableSelection::DecorateCellsAlternateRow(Decorator decorator,
                                                int modulo,
                                                int shift) {
-  for (int y = y_min_; y <= y_max_; ++y) {
-    for (int x = x_min_; x <= x_max_; ++x) {
+  if (Defer([=](TableSelection& s) {
+        s.DecorateCellsAlternateRow(decorator, modulo, shift);
+      })) {
+    return;
+  }
+  for (int y = YBegin(y_min_); y <= YEnd(y_max_); ++y) {
+    for (int x = XBegin(x_min_); x <= XEnd(x_max_); ++x) {
       if (y % 2 == 1 && x % 2 == 1 && ((y / 2) % modulo == shift)) {
-        Element& e = table_->elements_[y][x];
+        Element& e = table_->At(x, y);
         e = std::move(e) | decorator;
       }
     }
@@ -261,26 +586,44 @@ void TableSelection::DecorateCellsAlternateRow(Decorator decorator,
 }
 
 void TableSelection::Border(BorderStyle border) {
+  MarkSeparatorColumns(x_min_, x_min_);
+  MarkSeparatorColumns(x_max_, x_max_);
+  MarkSeparatorRows(y_min_, y_min_);
+  MarkSeparatorRows(y_max_, y_max_);
+  if (Defer([border](TableSelection& s) { s.Border(border); })) {
+    return;
+  }
+
   BorderLeft(border);
   BorderRight(border);
   BorderTop(border);
   BorderBottom(border);
 
+  const auto corner = [&](int x, int y, const std::string& c) {
+    if (table_->Contain(x, y)) {
+      table_->At(x, y) = text(c) | automerge;
+    }
+  };
   // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_min_] = text(charset[border][0]) | automerge;
+  corner(x_min_, y_min_, charset[border][0]);
   // NOLINTNEXTLINE
-  table_->elements_[y_min_][x_max_] = text(charset[border][1]) | automerge;
+  corner(x_max_, y_min_, charset[border][1]);
   // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_min_] = text(charset[border][2]) | automerge;
+  corner(x_min_, y_max_, charset[border][2]);
   // NOLINTNEXTLINE
-  table_->elements_[y_max_][x_max_] = text(charset[border][3]) | automerge;
+  corner(x_max_, y_max_, charset[border][3]);
 }
 
 void TableSelection::Separator(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
+  MarkSeparatorColumns(x_min_ + 1, x_max_ - 1);
+  MarkSeparatorRows(y_min_ + 1, y_max_ - 1);
+  if (Defer([border](TableSelection& s) { s.Separator(border); })) {
+    return;
+  }
+  for (int y = YBegin(y_min_ + 1); y <= YEnd(y_max_ - 1); ++y) {
+    for (int x = XBegin(x_min_ + 1); x <= XEnd(x_max_ - 1); ++x) {
       if (y % 2 == 0 || x % 2 == 0) {
-        Element& e = table_->elements_[y][x];
+        Element& e = table_->At(x, y);
         e = (y % 2 == 1)
                 ? separatorCharacter(charset[border][5]) | automerge   // NOLINT
                 : separatorCharacter(charset[border][4]) | automerge;  // NOLINT
@@ -290,10 +633,14 @@ void TableSelection::Separator(BorderStyle border) {
 }
 
 void TableSelection::SeparatorVertical(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
+  MarkSeparatorColumns(x_min_ + 1, x_max_ - 1);
+  if (Defer([border](TableSelection& s) { s.SeparatorVertical(border); })) {
+    return;
+  }
+  for (int y = YBegin(y_min_ + 1); y <= YEnd(y_max_ - 1); ++y) {
+    for (int x = XBegin(x_min_ + 1); x <= XEnd(x_max_ - 1); ++x) {
       if (x % 2 == 0) {
-        table_->elements_[y][x] =
+        table_->At(x, y) =
             separatorCharacter(charset[border][5]) | automerge;  // NOLINT
       }
     }
@@ -301,10 +648,14 @@ void TableSelection::SeparatorVertical(BorderStyle border) {
 }
 
 void TableSelection::SeparatorHorizontal(BorderStyle border) {
-  for (int y = y_min_ + 1; y <= y_max_ - 1; ++y) {
-    for (int x = x_min_ + 1; x <= x_max_ - 1; ++x) {
+  MarkSeparatorRows(y_min_ + 1, y_max_ - 1);
+  if (Defer([border](TableSelection& s) { s.SeparatorHorizontal(border); })) {
+    return;
+  }
+  for (int y = YBegin(y_min_ + 1); y <= YEnd(y_max_ - 1); ++y) {
+    for (int x = XBegin(x_min_ + 1); x <= XEnd(x_max_ - 1); ++x) {
       if (y % 2 == 0) {
-        table_->elements_[y][x] =
+        table_->At(x, y) =
             separatorCharacter(charset[border][4]) | automerge;  // NOLINT
       }
     }
@@ -312,29 +663,57 @@ void TableSelection::SeparatorHorizontal(BorderStyle border) {
 }
 
 void TableSelection::BorderLeft(BorderStyle border) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_min_] =
+  MarkSeparatorColumns(x_min_, x_min_);
+  if (Defer([border](TableSelection& s) { s.BorderLeft(border); })) {
+    return;
+  }
+  if (x_min_ < XBegin(x_min_) || x_min_ > XEnd(x_min_)) {
+    return;
+  }
+  for (int y = YBegin(y_min_); y <= YEnd(y_max_); y++) {
+    table_->At(x_min_, y) =
         separatorCharacter(charset[border][5]) | automerge;  // NOLINT
   }
 }
 
 void TableSelection::BorderRight(BorderStyle border) {
-  for (int y = y_min_; y <= y_max_; y++) {
-    table_->elements_[y][x_max_] =
+  MarkSeparatorColumns(x_max_, x_max_);
+  if (Defer([border](TableSelection& s) { s.BorderRight(border); })) {
+    return;
+  }
+  if (x_max_ < XBegin(x_max_) || x_max_ > XEnd(x_max_)) {
+    return;
+  }
+  for (int y = YBegin(y_min_); y <= YEnd(y_max_); y++) {
+    table_->At(x_max_, y) =
         separatorCharacter(charset[border][5]) | automerge;  // NOLINT
   }
 }
 
 void TableSelection::BorderTop(BorderStyle border) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_min_][x] =
+  MarkSeparatorRows(y_min_, y_min_);
+  if (Defer([border](TableSelection& s) { s.BorderTop(border); })) {
+    return;
+  }
+  if (y_min_ < YBegin(y_min_) || y_min_ > YEnd(y_min_)) {
+    return;
+  }
+  for (int x = XBegin(x_min_); x <= XEnd(x_max_); x++) {
+    table_->At(x, y_min_) =
         separatorCharacter(charset[border][4]) | automerge;  // NOLINT
   }
 }
 
 void TableSelection::BorderBottom(BorderStyle border) {
-  for (int x = x_min_; x <= x_max_; x++) {
-    table_->elements_[y_max_][x] =
+  MarkSeparatorRows(y_max_, y_max_);
+  if (Defer([border](TableSelection& s) { s.BorderBottom(border); })) {
+    return;
+  }
+  if (y_max_ < YBegin(y_max_) || y_max_ > YEnd(y_max_)) {
+    return;
+  }
+  for (int x = XBegin(x_min_); x <= XEnd(x_max_); x++) {
+    table_->At(x, y_max_) =
         separatorCharacter(charset[border][4]) | automerge;  // NOLINT
   }
 }
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <memory>  // for allocator
+#include <string>  // for string, to_string
 
 #include "ftxui/dom/elements.hpp"  // for LIGHT, flex, center, EMPTY, DOUBLE
 #include "ftxui/dom/node.hpp"      // for Render
@@ -731,6 +732,68 @@ TEST(TableTest, Merge) {
       screen.ToString());
 }
 
+TEST(TableTest, VirtualMatchesEager) {
+  const std::vector<std::vector<std::string>> data = {
+      {"a", "bb", "c"},
+      {"dd", "e", "f"},
+      {"g", "h", "iii"},
+  };
+  auto decorate = [](Table& table) {
+    table.SelectAll().Border(LIGHT);
+    table.SelectColumn(1).Border(HEAVY);
+    table.SelectRow(1).Border(HEAVY);
+    table.SelectRow(0).SeparatorVertical(LIGHT);
+    table.SelectRow(2).Decorate(inverted);
+  };
+
+  auto eager = Table(data);
+  decorate(eager);
+  auto lazy = Table(3, 3, [&](int row, int column) {
+    return data[row][column];
+  });
+  decorate(lazy);
+
+  Screen screen_eager(12, 9);
+  Screen screen_lazy(12, 9);
+  Render(screen_eager, eager.Render());
+  Render(screen_lazy, lazy.Render());
+  EXPECT_EQ(screen_eager.ToString(), screen_lazy.ToString());
+}
+
+TEST(TableTest, VirtualOnlyVisibleCells) {
+  int calls = 0;
+  auto table = Table(1'000'000, 2, [&](int row, int column) {
+    ++calls;
+    return std::to_string(row * 2 + column);
+  });
+  table.SetColumnWidth(0, 7);
+  table.SetColumnWidth(1, 7);
+  table.SelectAll().SeparatorVertical(LIGHT);
+  auto document = table.Render() | focusPositionRelative(0, 0.5) | frame;
+  Screen screen(15, 3);
+  Render(screen, document);
+  EXPECT_EQ(
+      "999998 │999999 \r\n"
+      "1000000│1000001\r\n"
+      "1000002│1000003",
+      screen.ToString());
+  EXPECT_EQ(calls, 6);
+}
+
+TEST(TableTest, VirtualSampledWidth) {
+  auto table = Table(100, 1, [](int row, int /*column*/) {
+    return row == 99 ? std::string("long") : std::string("x");
+  });
+  table.SelectAll().Border(LIGHT);
+  Screen screen(6, 3);
+  Render(screen, table.Render());
+  EXPECT_EQ(
+      "┌────┐\r\n"
+      "│x   │\r\n"
+      "│x   │",
+      screen.ToString());
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -1,16 +1,20 @@
 #include <algorithm>  // for min
+#include <cstdint>    // for uint8_t
 #include <memory>     // for make_shared
 #include <string>     // for string, wstring
 #include <utility>    // for move
 #include <vector>     // for vector
 
-#include "ftxui/dom/deprecated.hpp"   // for text, vtext
-#include "ftxui/dom/elements.hpp"     // for Element, text, vtext
-#include "ftxui/dom/node.hpp"         // for Node
-#include "ftxui/dom/requirement.hpp"  // for Requirement
-#include "ftxui/screen/box.hpp"       // for Box
-#include "ftxui/screen/screen.hpp"    // for Pixel, Screen
-#include "ftxui/screen/string.hpp"  // for string_width, Utf8ToGlyphs, to_string
+#include "ftxui/dom/deprecated.hpp"    // for text, vtext
+#include "ftxui/dom/display_list.hpp"  // for DisplayList
+#include "ftxui/dom/elements.hpp"      // for Element, text, vtext, richText
+#include "ftxui/dom/hash.hpp"          // for HashValue
+#include "ftxui/dom/node.hpp"          // for Node
+#include "ftxui/dom/requirement.hpp"   // for Requirement
+#include "ftxui/dom/style.hpp"         // for Span, Style
+#include "ftxui/screen/box.hpp"        // for Box
+#include "ftxui/screen/screen.hpp"     // for Pixel, Screen
+#include "ftxui/screen/string.hpp"     // for string_width, Utf8ToGlyphs, to_string
 
 namespace ftxui {
 
@@ -28,11 +32,13 @@ class Text : public Node {
   void Render(Screen& screen) override {
     int x = box_.x_min;
     const int y = box_.y_min;
-    if (y > box_.y_max) {
+    if (y > box_.y_max || y < screen.stencil.y_min ||
+        y > screen.stencil.y_max) {
       return;
     }
+    const int x_max = std::min(box_.x_max, screen.stencil.x_max);
     for (const auto& cell : Utf8ToGlyphs(text_)) {
-      if (x > box_.x_max) {
+      if (x > x_max) {
         return;
       }
       if (cell == "\n") {
@@ -43,10 +49,103 @@ class Text : public Node {
     }
   }
 
+  void Compile(DisplayList& list) override {
+    if (box_.y_min > box_.y_max) {
+      return;
+    }
+    list.DrawGlyphs(box_.x_min, box_.y_min, box_.x_max, text_);
+  }
+
+  bool Hash(size_t* hash) override {
+    HashValue(hash, text_);
+    return HashChildren(hash);
+  }
+
  private:
   std::string text_;
 };
 
+class RichText : public Node {
+ public:
+  explicit RichText(std::vector<Span> spans) : spans_(std::move(spans)) {}
+
+  void ComputeRequirement() override {
+    requirement_.min_x = 0;
+    for (const auto& span : spans_) {
+      requirement_.min_x += string_width(span.text);
+    }
+    requirement_.min_y = 1;
+  }
+
+  void Render(Screen& screen) override {
+    int x = box_.x_min;
+    const int y = box_.y_min;
+    if (y > box_.y_max || y < screen.stencil.y_min ||
+        y > screen.stencil.y_max) {
+      return;
+    }
+    const int x_max = std::min(box_.x_max, screen.stencil.x_max);
+    for (const auto& span : spans_) {
+      const uint8_t link =
+          span.link.empty() ? 0 : screen.RegisterHyperlink(span.link);
+      for (const auto& cell : Utf8ToGlyphs(span.text)) {
+        if (x > x_max) {
+          return;
+        }
+        if (cell == "\n") {
+          continue;
+        }
+        Pixel& pixel = screen.PixelAt(x, y);
+        pixel.character = cell;
+        span.style.Apply(pixel);
+        if (link) {
+          pixel.hyperlink = link;
+        }
+        ++x;
+      }
+    }
+  }
+
+  void Compile(DisplayList& list) override {
+    // Hyperlinks are registered into the screen while drawing.
+    for (const auto& span : spans_) {
+      if (!span.link.empty()) {
+        list.Draw(this);
+        return;
+      }
+    }
+
+    if (box_.y_min > box_.y_max) {
+      return;
+    }
+    int x = box_.x_min;
+    for (const auto& span : spans_) {
+      if (x > box_.x_max) {
+        return;
+      }
+      const int width = string_width(span.text);
+      list.DrawGlyphs(x, box_.y_min, box_.x_max, span.text);
+      if (!span.style.empty() && width > 0) {
+        const int x_max = std::min(x + width - 1, box_.x_max);
+        list.ApplyStyle(Box{x, x_max, box_.y_min, box_.y_min}, span.style);
+      }
+      x += width;
+    }
+  }
+
+  bool Hash(size_t* hash) override {
+    for (const auto& span : spans_) {
+      HashValue(hash, span.text);
+      HashValue(hash, span.style);
+      HashValue(hash, span.link);
+    }
+    return HashChildren(hash);
+  }
+
+ private:
+  std::vector<Span> spans_;
+};
+
 class VText : public Node {
  public:
   explicit VText(std::string text)
@@ -72,6 +171,11 @@ class VText : public Node {
     }
   }
 
+  bool Hash(size_t* hash) override {
+    HashValue(hash, text_);
+    return HashChildren(hash);
+  }
+
  private:
   std::string text_;
   int width_ = 1;
@@ -115,6 +219,25 @@ Element text(std::wstring text) {  // NOLINT
   return std::make_shared<Text>(to_string(text));
 }
 
+/// @brief Display a line of text made of several pieces, each having its own
+/// style and optionally a hyperlink. This is equivalent to an hbox of styled
+/// texts, but measured and drawn in a single pass.
+/// @param spans The pieces of text.
+/// @ingroup dom
+///
+/// ### Example
+///
+/// ```cpp
+/// Element document = richText({
+///     {"[INFO] ", Style::Foreground(Color::Green)},
+///     {"Server started on "},
+///     {"localhost:8080", Style::Set(Style::kUnderlined), "http://localhost:8080"},
+/// });
+/// ```
+Element richText(std::vector<Span> spans) {
+  return std::make_shared<RichText>(std::move(spans));
+}
+
 /// @brief Display a piece of unicode text vertically.
 /// @ingroup dom
 /// @see ftxui::to_wstring
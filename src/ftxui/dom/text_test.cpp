@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 #include <string>  // for allocator, string
 
-#include "ftxui/dom/elements.hpp"   // for text, operator|, border, Element
-#include "ftxui/dom/node.hpp"       // for Render
-#include "ftxui/screen/screen.hpp"  // for Screen
+#include "ftxui/dom/display_list.hpp"  // for Compile, Render
+#include "ftxui/dom/elements.hpp"      // for text, operator|, border, richText, Element
+#include "ftxui/dom/node.hpp"          // for Render
+#include "ftxui/dom/style.hpp"         // for Span, Style
+#include "ftxui/screen/color.hpp"      // for Color, Color::Red
+#include "ftxui/screen/screen.hpp"     // for Screen
 
 // NOLINTBEGIN
 namespace ftxui {
@@ -118,6 +121,60 @@ TEST(TextTest, CombiningCharactersWithSpace) {
   EXPECT_EQ(t, screen.ToString());
 }
 
+TEST(TextTest, RichText) {
+  auto element = richText({
+      {"ab", Style::Set(Style::kBold), ""},
+      {"cd", Style::Foreground(Color::Red), "https://github.com"},
+      {"e", {}, ""},
+  });
+  Screen screen(6, 1);
+  Render(screen, element);
+  std::string characters;
+  for (int x = 0; x < 6; ++x) {
+    characters += screen.PixelAt(x, 0).character;
+  }
+  EXPECT_EQ(characters, "abcde ");
+  EXPECT_TRUE(screen.PixelAt(1, 0).bold);
+  EXPECT_FALSE(screen.PixelAt(2, 0).bold);
+  EXPECT_EQ(screen.PixelAt(2, 0).foreground_color, Color::Red);
+  EXPECT_EQ(screen.PixelAt(4, 0).foreground_color, Color());
+  EXPECT_EQ(screen.PixelAt(1, 0).hyperlink, 0);
+  EXPECT_EQ(screen.Hyperlink(screen.PixelAt(3, 0).hyperlink),
+            "https://github.com");
+}
+
+TEST(TextTest, RichTextClipped) {
+  auto element = richText({
+      {"abc", Style::Set(Style::kUnderlined), ""},
+      {"def", Style::Set(Style::kBold), ""},
+  });
+  Screen screen(4, 1);
+  Render(screen, element);
+  EXPECT_EQ(screen.PixelAt(3, 0).character, "d");
+  EXPECT_TRUE(screen.PixelAt(3, 0).bold);
+  EXPECT_FALSE(screen.PixelAt(3, 0).underlined);
+}
+
+TEST(TextTest, RichTextMatchesHbox) {
+  auto rich = richText({
+      {"ＨＥＬＬＯ", Style::Set(Style::kBold), ""},
+      {" world", Style::Toggle(Style::kInverted), ""},
+  });
+  auto boxed = hbox({
+      text("ＨＥＬＬＯ") | bold,
+      text(" world") | inverted,
+  });
+  Screen expected(20, 1);
+  Render(expected, boxed);
+  Screen screen(20, 1);
+  Render(screen, rich);
+  EXPECT_EQ(screen.ToString(), expected.ToString());
+
+  Screen compiled(20, 1);
+  Render(compiled, Compile(compiled, rich));
+  EXPECT_EQ(compiled.ToString(), expected.ToString());
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -0,0 +1,207 @@
+#include "ftxui/dom/time_series.hpp"
+
+#include <algorithm>  // for max, min
+#include <cmath>      // for lround
+#include <cstddef>    // for size_t
+#include <memory>     // for make_shared
+#include <utility>    // for move
+#include <vector>     // for vector
+
+#include "ftxui/dom/canvas.hpp"       // for Canvas
+#include "ftxui/dom/elements.hpp"     // for Element, timeSeries
+#include "ftxui/dom/node.hpp"         // for Node
+#include "ftxui/dom/requirement.hpp"  // for Requirement
+#include "ftxui/screen/box.hpp"       // for Box
+#include "ftxui/screen/screen.hpp"    // for Screen
+#include "ftxui/util/ref.hpp"         // for ConstRef
+
+namespace ftxui {
+
+/// @brief Constructor.
+/// @param capacity the number of samples kept.
+TimeSeries::TimeSeries(size_t capacity)
+    : values_(capacity),
+      blocks_((capacity + kBlockSize - 1) / kBlockSize) {}
+
+/// @brief Append a sample. Once full, the oldest one is dropped.
+/// @param value the sample.
+void TimeSeries::Push(float value) {
+  if (values_.empty()) {
+    return;
+  }
+  size_t slot = 0;
+  if (size_ < values_.size()) {
+    slot = Slot(size_);
+    ++size_;
+  } else {
+    slot = start_;
+    start_ = Slot(1);
+  }
+  values_[slot] = value;
+
+  // The slots are written in order. A block starts anew with its first slot.
+  Bounds& block = blocks_[slot / kBlockSize];
+  if (slot % kBlockSize == 0) {
+    block = {value, value};
+  } else {
+    block.low = std::min(block.low, value);
+    block.high = std::max(block.high, value);
+  }
+}
+
+/// @brief Remove every sample.
+void TimeSeries::Clear() {
+  start_ = 0;
+  size_ = 0;
+}
+
+/// @brief The lowest and the highest of a range of samples.
+/// @param begin the first sample of the range, from the oldest one.
+/// @param end the end of the range, from the oldest one.
+TimeSeries::Bounds TimeSeries::Range(size_t begin, size_t end) const {
+  Bounds bounds;
+  bounds.low = bounds.high = (*this)[begin];
+
+  // The range is at most two runs of slots, around the end of |values_|.
+  const size_t slot_begin = Slot(begin);
+  const size_t slot_end = slot_begin + (end - begin);
+  if (slot_end <= values_.size()) {
+    Extend(slot_begin, slot_end, &bounds);
+  } else {
+    Extend(slot_begin, values_.size(), &bounds);
+    Extend(0, slot_end - values_.size(), &bounds);
+  }
+  return bounds;
+}
+
+void TimeSeries::Extend(size_t begin, size_t end, Bounds* bounds) const {
+  const size_t last_block = Slot(size_ - 1) / kBlockSize;
+  while (begin < end) {
+    const size_t block = begin / kBlockSize;
+    const size_t block_end = std::min((block + 1) * kBlockSize, values_.size());
+    if (begin == block * kBlockSize && end >= block_end &&
+        block != last_block) {
+      bounds->low = std::min(bounds->low, blocks_[block].low);
+      bounds->high = std::max(bounds->high, blocks_[block].high);
+      begin = block_end;
+      continue;
+    }
+    for (; begin < std::min(end, block_end); ++begin) {
+      bounds->low = std::min(bounds->low, values_[begin]);
+      bounds->high = std::max(bounds->high, values_[begin]);
+    }
+  }
+}
+
+namespace {
+
+class TimeSeriesNode : public Node {
+ public:
+  TimeSeriesNode(ConstRef<TimeSeries> series, bool fixed, float low, float high)
+      : series_(std::move(series)), fixed_(fixed), low_(low), high_(high) {}
+
+  void ComputeRequirement() override {
+    requirement_.flex_grow_x = 1;
+    requirement_.flex_grow_y = 1;
+    requirement_.flex_shrink_x = 1;
+    requirement_.flex_shrink_y = 1;
+    requirement_.min_x = 3;
+    requirement_.min_y = 3;
+  }
+
+  void Render(Screen& screen) override {
+    const TimeSeries& series = *series_;
+    const int width = (box_.x_max - box_.x_min + 1) * 2;
+    const int height = (box_.y_max - box_.y_min + 1) * 4;
+    if (width <= 0 || height <= 0 || series.size() == 0) {
+      return;
+    }
+
+    // Every column of dots shows the bounds of a bucket of samples. The most
+    // recent samples are on the right.
+    const size_t size = series.size();
+    const size_t columns = std::min(size, size_t(width));
+    std::vector<TimeSeries::Bounds> buckets(columns);
+    for (size_t i = 0; i < columns; ++i) {
+      buckets[i] = series.Range(size * i / columns, size * (i + 1) / columns);
+    }
+
+    float low = low_;
+    float high = high_;
+    if (!fixed_) {
+      low = buckets[0].low;
+      high = buckets[0].high;
+      for (const auto& bucket : buckets) {
+        low = std::min(low, bucket.low);
+        high = std::max(high, bucket.high);
+      }
+    }
+    auto row = [&](float value) {
+      if (high <= low) {
+        return height / 2;
+      }
+      const long r = std::lround((high - value) / (high - low) * (height - 1));
+      return int(std::max(0L, std::min(long(height - 1), r)));
+    };
+
+    Canvas canvas(width, height);
+    int previous_top = 0;
+    int previous_bottom = height - 1;
+    for (size_t i = 0; i < columns; ++i) {
+      int top = row(buckets[i].high);
+      int bottom = row(buckets[i].low);
+      // Join the previous column, so that the line has no holes.
+      if (i != 0) {
+        top = std::min(top, previous_bottom + 1);
+        bottom = std::max(bottom, previous_top - 1);
+      }
+      const int x = width - int(columns - i);
+      canvas.DrawPointLine(x, top, x, bottom);
+      previous_top = top;
+      previous_bottom = bottom;
+    }
+    canvas.Blit(screen, box_);
+  }
+
+ private:
+  ConstRef<TimeSeries> series_;
+  bool fixed_;
+  float low_;
+  float high_;
+};
+
+}  // namespace
+
+/// @brief Draw the samples of a TimeSeries, scaled to fit its box.
+/// @param series the samples.
+/// @ingroup dom
+///
+/// The samples are divided into buckets, one per column of braille dots. Each
+/// column shows the lowest and the highest sample of its bucket, so that no
+/// peak is lost however many samples there are.
+///
+/// ### Example
+///
+/// ```cpp
+/// TimeSeries series(10000);
+/// series.Push(value);
+/// Element document = timeSeries(&series) | color(Color::Green);
+/// ```
+Element timeSeries(ConstRef<TimeSeries> series) {
+  return std::make_shared<TimeSeriesNode>(std::move(series), false, 0.F, 0.F);
+}
+
+/// @brief Draw the samples of a TimeSeries, between two values.
+/// @param series the samples.
+/// @param low the value at the bottom of the box.
+/// @param high the value at the top of the box.
+/// @ingroup dom
+Element timeSeries(ConstRef<TimeSeries> series, float low, float high) {
+  return std::make_shared<TimeSeriesNode>(std::move(series), true, low, high);
+}
+
+}  // namespace ftxui
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
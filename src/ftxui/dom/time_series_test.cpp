@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <algorithm>      // for max, min
+#include <cstddef>        // for size_t
+#include <string>         // for allocator, string
+
+#include "ftxui/dom/elements.hpp"     // for timeSeries, size, operator|
+#include "ftxui/dom/node.hpp"         // for Render
+#include "ftxui/dom/time_series.hpp"  // for TimeSeries
+#include "ftxui/screen/screen.hpp"    // for Screen
+
+// NOLINTBEGIN
+namespace ftxui {
+
+TEST(TimeSeriesTest, Push) {
+  TimeSeries series(3);
+  EXPECT_EQ(series.size(), 0u);
+  EXPECT_EQ(series.capacity(), 3u);
+  series.Push(1);
+  series.Push(2);
+  EXPECT_EQ(series.size(), 2u);
+  series.Push(3);
+  series.Push(4);
+  EXPECT_EQ(series.size(), 3u);
+  EXPECT_EQ(series[0], 2);
+  EXPECT_EQ(series[1], 3);
+  EXPECT_EQ(series[2], 4);
+  series.Clear();
+  EXPECT_EQ(series.size(), 0u);
+}
+
+TEST(TimeSeriesTest, Range) {
+  // Compare with a scan of the samples, while the buffer fills up and wraps
+  // around.
+  TimeSeries series(1000);
+  unsigned int seed = 0;
+  for (int i = 0; i < 3500; ++i) {
+    seed = seed * 1103515245u + 12345u;
+    series.Push(float(seed >> 16) / 65536.F);
+    if (i % 97 != 0) {
+      continue;
+    }
+    for (int j = 0; j < 20; ++j) {
+      seed = seed * 1103515245u + 12345u;
+      const size_t begin = (seed >> 8) % series.size();
+      seed = seed * 1103515245u + 12345u;
+      const size_t end = begin + 1 + (seed >> 8) % (series.size() - begin);
+      float low = series[begin];
+      float high = series[begin];
+      for (size_t k = begin; k < end; ++k) {
+        low = std::min(low, series[k]);
+        high = std::max(high, series[k]);
+      }
+      const TimeSeries::Bounds bounds = series.Range(begin, end);
+      EXPECT_EQ(bounds.low, low);
+      EXPECT_EQ(bounds.high, high);
+    }
+  }
+}
+
+TEST(TimeSeriesTest, Render) {
+  TimeSeries series(100);
+  for (int i = 0; i < 8; ++i) {
+    series.Push(float(i));
+  }
+  auto document = timeSeries(&series) | size(WIDTH, EQUAL, 4) |
+                  size(HEIGHT, EQUAL, 2);
+  Screen screen(4, 2);
+  Render(screen, document);
+  EXPECT_EQ(screen.ToString(),
+            "  \xE2\xA1\xA0\xE2\xA0\x8A\r\n"
+            "\xE2\xA1\xA0\xE2\xA0\x8A  ");
+}
+
+TEST(TimeSeriesTest, Peak) {
+  // A single peak among many samples is still drawn.
+  TimeSeries series(100000);
+  for (int i = 0; i < 100000; ++i) {
+    series.Push(i == 54321 ? 1.F : 0.F);
+  }
+  Screen screen(10, 3);
+  Render(screen, timeSeries(&series, 0.F, 1.F));
+  int tops = 0;
+  for (int x = 0; x < 10; ++x) {
+    tops += screen.PixelAt(x, 0).character != " ";
+  }
+  EXPECT_EQ(tops, 1);
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.
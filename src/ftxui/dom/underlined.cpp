@@ -1,32 +1,15 @@
-#include <memory>   // for make_shared
 #include <utility>  // for move
 
-#include "ftxui/dom/elements.hpp"        // for Element, underlined
-#include "ftxui/dom/node.hpp"            // for Node
-#include "ftxui/dom/node_decorator.hpp"  // for NodeDecorator
-#include "ftxui/screen/box.hpp"          // for Box
-#include "ftxui/screen/screen.hpp"       // for Pixel, Screen
+#include "ftxui/dom/elements.hpp"  // for Element, underlined
+#include "ftxui/dom/style.hpp"     // for Style
+#include "ftxui/dom/styled.hpp"    // for Stylize
 
 namespace ftxui {
 
-class Underlined : public NodeDecorator {
- public:
-  using NodeDecorator::NodeDecorator;
-
-  void Render(Screen& screen) override {
-    Node::Render(screen);
-    for (int y = box_.y_min; y <= box_.y_max; ++y) {
-      for (int x = box_.x_min; x <= box_.x_max; ++x) {
-        screen.PixelAt(x, y).underlined = true;
-      }
-    }
-  }
-};
-
 /// @brief Make the underlined element to be underlined.
 /// @ingroup dom
 Element underlined(Element child) {
-  return std::make_shared<Underlined>(std::move(child));
+  return Stylize(std::move(child), {}, Style::Set(Style::kUnderlined));
 }
 
 }  // namespace ftxui
@@ -135,6 +135,8 @@ Element emptyElement() {
       requirement_.min_x = 0;
       requirement_.min_y = 0;
     }
+
+    bool Hash(size_t* hash) override { return HashChildren(hash); }
   };
   return std::make_unique<Impl>();
 }
@@ -1,11 +1,13 @@
 #include <gtest/gtest.h>
 #include <algorithm>  // for remove
 #include <cstddef>    // for size_t
+#include <memory>     // for make_shared
 #include <string>     // for string, allocator, basic_string
 #include <vector>     // for vector
 
-#include "ftxui/dom/elements.hpp"  // for vtext, operator|, vbox, Element, flex_grow, flex_shrink
+#include "ftxui/dom/elements.hpp"  // for vtext, operator|, vbox, Element, flex_grow, flex_shrink, frame, reflect
 #include "ftxui/dom/node.hpp"       // for Render
+#include "ftxui/screen/box.hpp"     // for Box
 #include "ftxui/screen/screen.hpp"  // for Screen
 
 // NOLINTBEGIN
@@ -18,6 +20,20 @@ std::string rotate(std::string str) {
   return str;
 }
 
+// A line counting how many times it is drawn.
+class CountedLine : public Node {
+ public:
+  explicit CountedLine(int* count) : count_(count) {}
+  void ComputeRequirement() override {
+    requirement_.min_x = 1;
+    requirement_.min_y = 1;
+  }
+  void Render(Screen&) override { ++*count_; }
+
+ private:
+  int* count_;
+};
+
 }  // namespace
 
 TEST(VBoxText, NoFlex_NoFlex_NoFlex) {
@@ -365,6 +381,70 @@ TEST(VBoxText, FlexGrow_NoFlex_FlewShrink) {
   }
 }
 
+TEST(VBoxText, OnlyVisibleChildrenAreRendered) {
+  int count = 0;
+  Elements lines;
+  for (int i = 0; i < 1000; ++i) {
+    lines.push_back(std::make_shared<CountedLine>(&count));
+  }
+  auto root = vbox(std::move(lines)) | focusPosition(0, 500) | frame;
+  Screen screen(1, 10);
+  Render(screen, root);
+  EXPECT_EQ(count, 10);
+}
+
+TEST(VBoxText, ReflectOutsideFrame) {
+  Box visible;
+  Box hidden;
+  auto root = vbox({
+                  text("visible") | reflect(visible),
+                  text("a"),
+                  text("b"),
+                  text("hidden") | reflect(hidden),
+              }) |
+              frame;
+  Screen screen(10, 2);
+  Render(screen, root);
+  EXPECT_TRUE(visible.Contain(0, 0));
+  EXPECT_TRUE(hidden.IsEmpty());
+}
+
+// Layout a vbox made of many children, one of four being flexible.
+TEST(VBoxText, ManyChildren) {
+  const int count = 50000;
+  Elements lines;
+  Elements children;
+  for (int i = 0; i < count; ++i) {
+    lines.push_back(text("x"));
+    children.push_back(i % 4 ? lines.back() : lines.back() | flex);
+  }
+  auto root = vbox(std::move(children));
+  root->ComputeRequirement();
+
+  for (const int size : {count * 2, count, count * 9 / 10, count / 2}) {
+    root->SetBox(Box{0, 0, 0, size - 1});
+    int y = 0;
+    for (int i = 0; i < count; ++i) {
+      const Box box = lines[i]->box();
+      const int child_size = box.y_max - box.y_min + 1;
+      EXPECT_EQ(box.y_min, y);
+      const bool flexible = i % 4 == 0;
+      if (size >= count) {
+        // Growing: The extra space is split among the flexible children.
+        EXPECT_EQ(child_size, flexible ? 1 + (size - count) / (count / 4) : 1);
+      } else if (size >= count * 3 / 4) {
+        // Shrinking: The flexible children absorb the missing space.
+        EXPECT_EQ(child_size, flexible ? child_size % 2 : 1);
+      } else {
+        // Shrinking more than the flexible children can absorb.
+        EXPECT_EQ(child_size, flexible ? 0 : child_size % 2);
+      }
+      y += child_size;
+    }
+    EXPECT_EQ(y, size);
+  }
+}
+
 }  // namespace ftxui
 // NOLINTEND
 
@@ -1,8 +1,11 @@
 #include "ftxui/screen/color.hpp"
 
-#include <array>  // for array
+#include <algorithm>  // for clamp, max, min
+#include <array>      // for array
 #include <cmath>
 #include <cstdint>
+#include <cstdlib>      // for abs
+#include <limits>       // for numeric_limits
 #include <string_view>  // for literals
 
 #include "ftxui/screen/color_info.hpp"  // for GetColorInfo, ColorInfo
@@ -32,6 +35,57 @@ const std::array<const char*, 33> palette16code = {
     "97", "107",  //
 };
 
+// The levels of the components of the 6x6x6 color cube of the 256 colors
+// palette, made of the colors 16 to 231. The 24 grays follow: 8, 18, ..., 238.
+constexpr std::array<int, 6> kCubeLevels = {0, 95, 135, 175, 215, 255};
+
+int Square(int value) {
+  return value * value;
+}
+
+// Find the closest color of the 256 colors palette, ignoring the 16 first ones.
+// This is the same as comparing against the 240 colors, the first closest one
+// winning, but using the layout of the palette.
+uint8_t ClosestPalette256(int red, int green, int blue) {
+  // In the cube, every component can be matched independently.
+  auto level = [](int value) {
+    int best = 0;
+    for (int i = 1; i < int(kCubeLevels.size()); ++i) {
+      if (std::abs(kCubeLevels[i] - value) <
+          std::abs(kCubeLevels[best] - value)) {
+        best = i;
+      }
+    }
+    return best;
+  };
+  const int r = level(red);
+  const int g = level(green);
+  const int b = level(blue);
+  const int cube_distance = Square(kCubeLevels[r] - red) +
+                            Square(kCubeLevels[g] - green) +
+                            Square(kCubeLevels[b] - blue);
+
+  // The distance to the grays is smallest next to the mean of the components.
+  const int mean_gray = std::clamp(((red + green + blue) / 3 - 3) / 10, 0, 23);
+  int gray = 0;
+  int gray_distance = std::numeric_limits<int>::max();
+  for (int i = std::max(0, mean_gray - 1); i <= std::min(23, mean_gray + 1);
+       ++i) {
+    const int value = 8 + 10 * i;
+    const int distance =
+        Square(value - red) + Square(value - green) + Square(value - blue);
+    if (distance < gray_distance) {
+      gray_distance = distance;
+      gray = i;
+    }
+  }
+
+  if (gray_distance < cube_distance) {
+    return uint8_t(232 + gray);
+  }
+  return uint8_t(16 + 36 * r + 6 * g + b);
+}
+
 }  // namespace
 
 bool Color::operator==(const Color& rhs) const {
@@ -99,22 +153,7 @@ Color::Color(uint8_t red, uint8_t green, uint8_t blue)
   }
 
   // Find the closest Color from the database:
-  const int max_distance = 256 * 256 * 3;
-  int closest = max_distance;
-  int best = 0;
-  const int database_begin = 16;
-  const int database_end = 256;
-  for (int i = database_begin; i < database_end; ++i) {
-    const ColorInfo color_info = GetColorInfo(Color::Palette256(i));
-    const int dr = color_info.red - red;
-    const int dg = color_info.green - green;
-    const int db = color_info.blue - blue;
-    const int dist = dr * dr + dg * dg + db * db;
-    if (closest > dist) {
-      closest = dist;
-      best = i;
-    }
-  }
+  const uint8_t best = ClosestPalette256(red, green, blue);
 
   if (Terminal::ColorSupport() == Terminal::Color::Palette256) {
     type_ = ColorType::Palette256;
@@ -1,5 +1,6 @@
 #include "ftxui/screen/color.hpp"
 #include <gtest/gtest.h>
+#include "ftxui/screen/color_info.hpp"
 #include "ftxui/screen/terminal.hpp"
 
 namespace ftxui {
@@ -38,6 +39,40 @@ TEST(ColorTest, FallbackTo16) {
   EXPECT_EQ(Color::RGB(1, 2, 3).Print(false), "30");
 }
 
+TEST(ColorTest, FallbackToClosest) {
+  // Compare with a search over the whole palette.
+  auto closest = [](int red, int green, int blue) {
+    int best = 0;
+    int best_distance = 256 * 256 * 3;
+    for (int i = 16; i < 256; ++i) {
+      const ColorInfo info = GetColorInfo(Color::Palette256(i));
+      const int dr = info.red - red;
+      const int dg = info.green - green;
+      const int db = info.blue - blue;
+      const int distance = dr * dr + dg * dg + db * db;
+      if (distance < best_distance) {
+        best_distance = distance;
+        best = i;
+      }
+    }
+    return best;
+  };
+
+  for (int red = 0; red < 256; red += 3) {
+    for (int green = 0; green < 256; green += 5) {
+      for (int blue = 0; blue < 256; blue += 7) {
+        const int expected = closest(red, green, blue);
+        Terminal::SetColorSupport(Terminal::Color::Palette256);
+        ASSERT_EQ(Color::RGB(red, green, blue).Print(false),
+                  Color(Color::Palette256(expected)).Print(false));
+        Terminal::SetColorSupport(Terminal::Color::Palette16);
+        ASSERT_EQ(Color::RGB(red, green, blue).Print(false),
+                  Color(Color::Palette256(expected)).Print(false));
+      }
+    }
+  }
+}
+
 TEST(ColorTest, Litterals) {
   Terminal::SetColorSupport(Terminal::Color::TrueColor);
   using namespace ftxui::literals;
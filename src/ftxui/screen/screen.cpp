@@ -1,10 +1,13 @@
-#include <cstdint>  // for size_t
+#include <algorithm>  // for max, min, copy, fill
+#include <cstdint>    // for size_t
 #include <iostream>  // for operator<<, stringstream, basic_ostream, flush, cout, ostream
 #include <limits>
 #include <map>      // for _Rb_tree_const_iterator, map, operator!=, operator==
 #include <memory>   // for allocator, allocator_traits<>::value_type
 #include <sstream>  // IWYU pragma: keep
+#include <thread>   // for thread
 #include <utility>  // for pair
+#include <vector>   // for vector
 
 #include "ftxui/screen/screen.hpp"
 #include "ftxui/screen/string.hpp"    // for string_width
@@ -23,7 +26,8 @@ namespace ftxui {
 namespace {
 
 Pixel& dev_null_pixel() {
-  static Pixel pixel;
+  // Elements may be drawn from several threads. See ftxui::parallel.
+  thread_local Pixel pixel;
   return pixel;
 }
 
@@ -374,15 +378,18 @@ bool ShouldAttemptAutoMerge(Pixel& pixel) {
 }  // namespace
 
 bool Pixel::operator==(const Pixel& other) const {
-  return character == other.character &&                //
-         background_color == other.background_color &&  //
-         foreground_color == other.foreground_color &&  //
-         blink == other.blink &&                        //
-         bold == other.bold &&                          //
-         dim == other.dim &&                            //
-         inverted == other.inverted &&                  //
-         underlined == other.underlined &&              //
-         automerge == other.automerge;                  //
+  return character == other.character &&                  //
+         hyperlink == other.hyperlink &&                  //
+         background_color == other.background_color &&    //
+         foreground_color == other.foreground_color &&    //
+         blink == other.blink &&                          //
+         bold == other.bold &&                            //
+         dim == other.dim &&                              //
+         inverted == other.inverted &&                    //
+         underlined == other.underlined &&                //
+         underlined_double == other.underlined_double &&  //
+         strikethrough == other.strikethrough &&          //
+         automerge == other.automerge;                    //
 }
 
 /// A fixed dimension.
@@ -434,11 +441,53 @@ Screen::Screen(int dimx, int dimy)
 /// Screen::Print();
 std::string Screen::ToString() const {
   std::stringstream ss;
+  SerializeRows(ss, 0, dimy_);
+  return ss.str();
+}
+
+/// Same as ToString(), the rows being serialized concurrently by |threads|
+/// threads. The result is identical. This is useful for very large screens.
+std::string Screen::ToString(int threads) const {
+#if defined(__EMSCRIPTEN__)
+  (void)threads;
+  return ToString();
+#else
+  const int chunks = std::max(1, std::min(threads, dimy_));
+
+  // Every row starts from the default style, so the chunks of rows can be
+  // serialized independently, and concatenated.
+  std::vector<std::stringstream> outputs(chunks);
+  auto serialize = [&](int chunk) {
+    SerializeRows(outputs[chunk], dimy_ * chunk / chunks,
+                  dimy_ * (chunk + 1) / chunks);
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(chunks - 1);
+  for (int chunk = 1; chunk < chunks; ++chunk) {
+    workers.emplace_back(serialize, chunk);
+  }
+  serialize(0);
+  for (auto& worker : workers) {
+    worker.join();
+  }
 
+  std::string out = outputs[0].str();
+  for (int chunk = 1; chunk < chunks; ++chunk) {
+    out += outputs[chunk].str();
+  }
+  return out;
+#endif
+}
+
+// Serialize the rows [y_begin, y_end), starting from and ending with the
+// default style.
+void Screen::SerializeRows(std::stringstream& ss,
+                           int y_begin,
+                           int y_end) const {
   Pixel previous_pixel;
   const Pixel final_pixel;
 
-  for (int y = 0; y < dimy_; ++y) {
+  for (int y = y_begin; y < y_end; ++y) {
     if (y != 0) {
       UpdatePixelStyle(this, ss, previous_pixel, final_pixel);
       ss << "\r\n";
@@ -454,8 +503,6 @@ std::string Screen::ToString() const {
   }
 
   UpdatePixelStyle(this, ss, previous_pixel, final_pixel);
-
-  return ss.str();
 }
 
 // Print the Screen to the terminal.
@@ -491,6 +538,47 @@ const Pixel& Screen::PixelAt(int x, int y) const {
   return stencil.Contain(x, y) ? pixels_[y][x] : dev_null_pixel();
 }
 
+/// @brief Access the cells of a row, clipped to the stencil.
+/// @param y The row position along the y-axis.
+/// @param x_min The first cell position along the x-axis.
+/// @param x_max The last cell position along the x-axis.
+PixelSpan Screen::RowSpan(int y, int x_min, int x_max) {
+  PixelSpan span;
+  x_min = std::max(x_min, stencil.x_min);
+  x_max = std::min(x_max, stencil.x_max);
+  if (y < stencil.y_min || y > stencil.y_max || x_min > x_max) {
+    return span;
+  }
+  span.data = pixels_[y].data() + x_min;
+  span.x = x_min;
+  span.size = x_max - x_min + 1;
+  return span;
+}
+
+/// @brief Assign |pixel| to every cell of |box|, clipped to the stencil.
+void Screen::FillRect(const Box& box, const Pixel& pixel) {
+  const int y_min = std::max(box.y_min, stencil.y_min);
+  const int y_max = std::min(box.y_max, stencil.y_max);
+  for (int y = y_min; y <= y_max; ++y) {
+    const PixelSpan span = RowSpan(y, box.x_min, box.x_max);
+    std::fill(span.begin(), span.end(), pixel);
+  }
+}
+
+/// @brief Copy a run of cells into a row, clipped to the stencil.
+/// @param x The position of the first cell along the x-axis.
+/// @param y The row position along the y-axis.
+/// @param pixels The cells to copy.
+/// @param size The number of cells to copy.
+void Screen::BlitRow(int x, int y, const Pixel* pixels, int size) {
+  const PixelSpan span = RowSpan(y, x, x + size - 1);
+  if (span.size == 0) {
+    return;
+  }
+  std::copy(pixels + (span.x - x), pixels + (span.x - x) + span.size,
+            span.data);
+}
+
 /// @brief Return a string to be printed in order to reset the cursor position
 ///        to the beginning of the screen.
 ///
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>  // for Test, EXPECT_EQ, TEST
+#include <string>         // for allocator, string, to_string
+
+#include "ftxui/screen/box.hpp"     // for Box
+#include "ftxui/screen/color.hpp"   // for Color
+#include "ftxui/screen/screen.hpp"  // for Screen, Pixel, PixelSpan
+
+// NOLINTBEGIN
+namespace ftxui {
+
+namespace {
+
+// Fill |screen| with a variety of characters and styles.
+void Fill(Screen& screen) {
+  unsigned int seed = 0;
+  auto next = [&] {
+    seed = seed * 1103515245u + 12345u;
+    return (seed >> 16) & 0x7FFF;
+  };
+  const uint8_t link = screen.RegisterHyperlink("https://example.com");
+  const std::string characters[] = {"a", "b", " ", "─", "测"};
+  for (int y = 0; y < screen.dimy(); ++y) {
+    for (int x = 0; x < screen.dimx(); ++x) {
+      Pixel& pixel = screen.PixelAt(x, y);
+      // Styles are kept for a few cells, like in real documents.
+      if (x % 7 == 0) {
+        pixel.bold = next() % 2;
+        pixel.dim = next() % 3 == 0;
+        pixel.underlined = next() % 4 == 0;
+        pixel.inverted = next() % 5 == 0;
+        pixel.hyperlink = next() % 6 == 0 ? link : 0;
+        pixel.foreground_color = Color::Palette256(next() % 256);
+        pixel.background_color =
+            next() % 2 ? Color() : Color::RGB(next() % 256, 0, 128);
+      } else {
+        Pixel& previous = screen.PixelAt(x - 1, y);
+        pixel.bold = previous.bold;
+        pixel.dim = previous.dim;
+        pixel.underlined = previous.underlined;
+        pixel.inverted = previous.inverted;
+        pixel.hyperlink = previous.hyperlink;
+        pixel.foreground_color = previous.foreground_color;
+        pixel.background_color = previous.background_color;
+      }
+      pixel.character = characters[next() % 5];
+    }
+  }
+}
+
+}  // namespace
+
+TEST(ScreenTest, ToStringThreads) {
+  for (const int dimy : {0, 1, 2, 7, 200}) {
+    Screen screen(150, dimy);
+    Fill(screen);
+    const std::string expected = screen.ToString();
+    for (const int threads : {0, 1, 2, 3, 8, 300}) {
+      EXPECT_EQ(screen.ToString(threads), expected);
+    }
+  }
+}
+
+TEST(ScreenTest, RowSpan) {
+  Screen screen(10, 5);
+  screen.stencil = Box{2, 7, 1, 3};
+
+  PixelSpan span = screen.RowSpan(2, 0, 4);
+  EXPECT_EQ(span.x, 2);
+  EXPECT_EQ(span.size, 3);
+  EXPECT_EQ(span.data, &screen.PixelAt(2, 2));
+
+  span = screen.RowSpan(2, 5, 20);
+  EXPECT_EQ(span.x, 5);
+  EXPECT_EQ(span.size, 3);
+
+  EXPECT_EQ(screen.RowSpan(0, 0, 9).size, 0);
+  EXPECT_EQ(screen.RowSpan(4, 0, 9).size, 0);
+  EXPECT_EQ(screen.RowSpan(2, 8, 9).size, 0);
+  EXPECT_EQ(screen.RowSpan(2, 5, 4).size, 0);
+}
+
+TEST(ScreenTest, FillRect) {
+  Screen screen(6, 4);
+  screen.stencil = Box{0, 4, 1, 3};
+  Pixel pixel;
+  pixel.character = "x";
+  screen.FillRect(Box{3, 10, -5, 2}, pixel);
+  EXPECT_EQ(screen.ToString(),
+            "      \r\n"
+            "   xx \r\n"
+            "   xx \r\n"
+            "      ");
+}
+
+TEST(ScreenTest, ForEachPixel) {
+  Screen screen(4, 3);
+  int count = 0;
+  screen.ForEachPixel(Box{1, 5, 1, 5}, [&](Pixel& pixel) {
+    pixel.character = "o";
+    count++;
+  });
+  EXPECT_EQ(count, 6);
+  EXPECT_EQ(screen.ToString(),
+            "    \r\n"
+            " ooo\r\n"
+            " ooo");
+}
+
+TEST(ScreenTest, BlitRow) {
+  Screen screen(5, 2);
+  screen.stencil = Box{1, 3, 0, 1};
+  Pixel pixels[6];
+  for (int i = 0; i < 6; ++i) {
+    pixels[i].character = std::to_string(i);
+  }
+  screen.BlitRow(-1, 0, pixels, 6);
+  screen.BlitRow(3, 1, pixels, 6);
+  screen.BlitRow(0, 5, pixels, 6);
+  EXPECT_EQ(screen.ToString(),
+            " 234 \r\n"
+            "   0 ");
+}
+
+}  // namespace ftxui
+// NOLINTEND
+
+// Copyright 2023 Arthur Sonzogni. All rights reserved.
+// Use of this source code is governed by the MIT license that can be found in
+// the LICENSE file.